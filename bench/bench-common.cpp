@@ -0,0 +1,350 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#include "bench-common.h"
+#include "soci-timer.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+using namespace soci;
+using namespace soci_bench;
+
+// Count all memory allocations performed by the program and, as this
+// replaces the global operator new, by SOCI libraries too.
+//
+// Allocations can happen in several threads at once in the multi-threaded
+// benchmarks, so the counter is only accessed using atomic operations.
+namespace
+{
+
+typedef long long alloc_counter_t;
+
+alloc_counter_t g_allocations = 0;
+
+#if defined(__GNUC__)
+
+inline void increment_allocations()
+{
+    __atomic_fetch_add(&g_allocations, 1, __ATOMIC_RELAXED);
+}
+
+inline alloc_counter_t get_allocations()
+{
+    return __atomic_load_n(&g_allocations, __ATOMIC_RELAXED);
+}
+
+#elif defined(_WIN32)
+
+inline void increment_allocations()
+{
+    InterlockedIncrement64(&g_allocations);
+}
+
+inline alloc_counter_t get_allocations()
+{
+    return InterlockedCompareExchange64(&g_allocations, 0, 0);
+}
+
+#else
+#error "Atomic operations are not implemented for this compiler."
+#endif
+
+} // anonymous namespace
+
+void * operator new(std::size_t size)
+#if !defined(SOCI_HAVE_CXX11) && !(defined(_MSC_VER) && _MSC_VER >= 1800)
+    throw(std::bad_alloc)
+#endif
+{
+    increment_allocations();
+
+    void * const p = std::malloc(size ? size : 1);
+    if (!p)
+    {
+        throw std::bad_alloc();
+    }
+
+    return p;
+}
+
+void operator delete(void * p) SOCI_NOEXCEPT
+{
+    std::free(p);
+}
+
+namespace
+{
+
+struct bench_result
+{
+    std::string name;
+    int operations;
+    int rowsPerOperation;
+    long long totalNs;
+    long long minNs;
+    long long p50Ns;
+    long long p90Ns;
+    long long p99Ns;
+    long long maxNs;
+    double allocationsPerOperation;
+};
+
+long long percentile(std::vector<long long> & samples, double p)
+{
+    std::size_t const n = static_cast<std::size_t>(p * (samples.size() - 1));
+    std::nth_element(samples.begin(), samples.begin() + n, samples.end());
+    return samples[n];
+}
+
+bench_result run_benchmark(benchmark & b, session & sql,
+    bench_options const & opts)
+{
+    using details::monotonic_nanoseconds;
+
+    b.setup(sql, opts);
+
+    for (int i = 0; i != opts.warmup; ++i)
+    {
+        b.run(i);
+    }
+
+    std::vector<long long> latencies(opts.iterations);
+
+    alloc_counter_t const allocationsStart = get_allocations();
+    long long const start = monotonic_nanoseconds();
+
+    for (int i = 0; i != opts.iterations; ++i)
+    {
+        long long const opStart = monotonic_nanoseconds();
+        b.run(opts.warmup + i);
+        latencies[i] = monotonic_nanoseconds() - opStart;
+    }
+
+    bench_result res;
+    res.totalNs = monotonic_nanoseconds() - start;
+    res.allocationsPerOperation
+        = static_cast<double>(get_allocations() - allocationsStart) / opts.iterations;
+
+    b.teardown(sql);
+
+    res.name = b.name();
+    res.operations = opts.iterations;
+    res.rowsPerOperation = b.rows_per_operation();
+    res.minNs = *std::min_element(latencies.begin(), latencies.end());
+    res.maxNs = *std::max_element(latencies.begin(), latencies.end());
+    res.p50Ns = percentile(latencies, 0.50);
+    res.p90Ns = percentile(latencies, 0.90);
+    res.p99Ns = percentile(latencies, 0.99);
+
+    return res;
+}
+
+void write_json_string(std::ostream & os, std::string const & s)
+{
+    os << '"';
+    for (std::string::const_iterator it = s.begin(); it != s.end(); ++it)
+    {
+        switch (*it)
+        {
+            case '"':  os << "\\\""; break;
+            case '\\': os << "\\\\"; break;
+            case '\n': os << "\\n"; break;
+            case '\t': os << "\\t"; break;
+            default:   os << *it;
+        }
+    }
+    os << '"';
+}
+
+void write_json(std::ostream & os, session & sql, bench_options const & opts,
+    std::vector<bench_result> const & results)
+{
+    os << std::fixed << std::setprecision(2);
+
+    os << "{\n  \"backend\": ";
+    write_json_string(os, sql.get_backend_name());
+    os << ",\n  \"connect_string\": ";
+    write_json_string(os, opts.connectString);
+    os << ",\n  \"iterations\": " << opts.iterations
+       << ",\n  \"rows\": " << opts.rows
+       << ",\n  \"batch\": " << opts.batch
+       << ",\n  \"blob_size\": " << opts.blobSize
+       << ",\n  \"threads\": " << opts.threads
+       << ",\n  \"benchmarks\": [";
+
+    for (std::size_t i = 0; i != results.size(); ++i)
+    {
+        bench_result const & r = results[i];
+        double const seconds = r.totalNs / 1e9;
+
+        os << (i ? "," : "") << "\n    {\n      \"name\": ";
+        write_json_string(os, r.name);
+        os << ",\n      \"operations\": " << r.operations
+           << ",\n      \"rows_per_op\": " << r.rowsPerOperation
+           << ",\n      \"ops_per_sec\": " << r.operations / seconds
+           << ",\n      \"rows_per_sec\": "
+           << static_cast<double>(r.operations) * r.rowsPerOperation / seconds
+           << ",\n      \"latency_ns\": { \"min\": " << r.minNs
+           << ", \"p50\": " << r.p50Ns
+           << ", \"p90\": " << r.p90Ns
+           << ", \"p99\": " << r.p99Ns
+           << ", \"max\": " << r.maxNs << " }"
+           << ",\n      \"allocations_per_op\": " << r.allocationsPerOperation
+           << "\n    }";
+    }
+
+    os << "\n  ]\n}\n";
+}
+
+void usage(char const * prog, char const * connectStringHelp)
+{
+    std::cerr << "Usage: " << prog << " [options]";
+    if (connectStringHelp)
+    {
+        std::cerr << " [backend://connect-string]\n"
+                     "\n"
+                  << connectStringHelp;
+    }
+
+    std::cerr
+        << "\n"
+           "\n"
+           "Options:\n"
+           "  --iterations N   number of timed operations per benchmark (1000)\n"
+           "  --warmup N       number of untimed operations before them (10)\n"
+           "  --rows N         number of rows in the table for selects (1000)\n"
+           "  --batch N        number of rows per bulk operation (100)\n"
+           "  --blob-size N    size of the blobs in bytes (4096)\n"
+           "  --threads N      maximal number of threads, if used (4)\n"
+           "  --filter NAME    only run benchmarks containing NAME\n"
+           "  --output FILE    write JSON results to FILE instead of stdout\n";
+}
+
+bool parse_int(char const * s, int & value, int minValue = 1)
+{
+    char * end;
+    long const l = std::strtol(s, &end, 10);
+    if (end == s || *end != '\0' || l < minValue || l > 1000000000L)
+    {
+        return false;
+    }
+
+    value = static_cast<int>(l);
+    return true;
+}
+
+} // anonymous namespace
+
+bool soci_bench::parse_command_line(int argc, char ** argv,
+    bench_options & opts, char const * connectStringHelp, int & exitCode)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string const arg = argv[i];
+        if (arg == "--help" || arg == "-h")
+        {
+            usage(argv[0], connectStringHelp);
+            exitCode = EXIT_SUCCESS;
+            return false;
+        }
+
+        if (arg.compare(0, 2, "--") != 0)
+        {
+            if (!connectStringHelp)
+            {
+                std::cerr << "Unexpected argument " << arg << "\n";
+                usage(argv[0], connectStringHelp);
+                exitCode = EXIT_FAILURE;
+                return false;
+            }
+
+            opts.connectString = arg;
+            continue;
+        }
+
+        if (i + 1 == argc)
+        {
+            std::cerr << "Missing value for option " << arg << "\n";
+            exitCode = EXIT_FAILURE;
+            return false;
+        }
+
+        char const * const value = argv[++i];
+        bool ok = true;
+        if (arg == "--iterations")
+            ok = parse_int(value, opts.iterations);
+        else if (arg == "--warmup")
+            ok = parse_int(value, opts.warmup, 0);
+        else if (arg == "--rows")
+            ok = parse_int(value, opts.rows);
+        else if (arg == "--batch")
+            ok = parse_int(value, opts.batch);
+        else if (arg == "--blob-size")
+            ok = parse_int(value, opts.blobSize);
+        else if (arg == "--threads")
+            ok = parse_int(value, opts.threads);
+        else if (arg == "--filter")
+            opts.filter = value;
+        else if (arg == "--output")
+            opts.output = value;
+        else
+            ok = false;
+
+        if (!ok)
+        {
+            std::cerr << "Invalid option " << arg << " " << value << "\n";
+            usage(argv[0], connectStringHelp);
+            exitCode = EXIT_FAILURE;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int soci_bench::run_benchmarks(session & sql, bench_options const & opts,
+    benchmark * const * benchmarks, std::size_t count)
+{
+    std::vector<bench_result> results;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        benchmark & b = *benchmarks[i];
+        if (std::string(b.name()).find(opts.filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        std::cerr << "Running " << b.name() << "..." << std::endl;
+        results.push_back(run_benchmark(b, sql, opts));
+    }
+
+    if (opts.output.empty())
+    {
+        write_json(std::cout, sql, opts, results);
+    }
+    else
+    {
+        std::ofstream ofs(opts.output.c_str());
+        write_json(ofs, sql, opts, results);
+        if (!ofs)
+        {
+            std::cerr << "Failed to write results to " << opts.output << "\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
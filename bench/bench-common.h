@@ -0,0 +1,89 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SOCI_BENCH_COMMON_H_INCLUDED
+#define SOCI_BENCH_COMMON_H_INCLUDED
+
+// Infrastructure shared by all SOCI benchmark programs: command line parsing,
+// timing of the benchmarks, counting memory allocations and JSON output.
+
+#include "soci/soci.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace soci_bench
+{
+
+struct bench_options
+{
+    bench_options()
+        : iterations(1000),
+          warmup(10),
+          rows(1000),
+          batch(100),
+          blobSize(4096),
+          threads(4)
+    {
+    }
+
+    std::string connectString;
+    std::string output;
+    std::string filter;
+    int iterations;
+    int warmup;
+    int rows;
+    int batch;
+    int blobSize;
+
+    // Only used by the multi-threaded benchmarks.
+    int threads;
+};
+
+// Base class for all benchmarks: setup() is called once before running the
+// benchmark, which consists in calling run() the given number of times, and
+// teardown() after it. Only run() is timed.
+class benchmark
+{
+public:
+    explicit benchmark(char const * name) : name_(name) {}
+    virtual ~benchmark() {}
+
+    char const * name() const { return name_; }
+
+    virtual void setup(soci::session & /* sql */,
+        bench_options const & /* opts */) {}
+    virtual void run(int i) = 0;
+    virtual void teardown(soci::session & /* sql */) {}
+
+    // Number of rows inserted or fetched by a single run() call.
+    virtual int rows_per_operation() const { return 1; }
+
+private:
+    char const * const name_;
+};
+
+// Parse the command line, filling the options. If the connect string is
+// non-NULL, it is used as its description in the usage message and the
+// default value of opts.connectString can be overridden by a non-option
+// argument, otherwise no such arguments are accepted.
+//
+// Returns true if the program should continue or false if it should exit
+// with the given code.
+bool parse_command_line(int argc, char ** argv, bench_options & opts,
+    char const * connectStringHelp, int & exitCode);
+
+// Run all the benchmarks matching the filter and output their results.
+//
+// Returns the program exit code.
+int run_benchmarks(soci::session & sql, bench_options const & opts,
+    benchmark * const * benchmarks, std::size_t count);
+
+} // namespace soci_bench
+
+#endif // SOCI_BENCH_COMMON_H_INCLUDED
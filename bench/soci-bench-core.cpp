@@ -0,0 +1,443 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Microbenchmarks of SOCI core overhead.
+//
+// This program uses the empty backend, which returns synthetic result sets
+// without doing any real work, so the measured times correspond to the time
+// spent in SOCI itself: statement execution logic, dispatching the into and
+// use elements to the backend, constructing dynamic rows and converting user
+// types. The output has the same format as the output of soci_bench.
+
+#include "bench-common.h"
+#include "soci/empty/soci-empty.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace soci;
+using namespace soci_bench;
+
+namespace
+{
+
+// Record used for benchmarking the type_conversion<> mapping.
+struct core_record
+{
+    int id;
+    long long n;
+    double d;
+    std::string s;
+};
+
+} // anonymous namespace
+
+namespace soci
+{
+
+template<>
+struct type_conversion<core_record>
+{
+    typedef values base_type;
+
+    static void from_base(values const & v, indicator /* ind */,
+        core_record & r)
+    {
+        r.id = v.get<int>(0);
+        r.n = v.get<long long>(1);
+        r.d = v.get<double>(2);
+        r.s = v.get<std::string>(3);
+    }
+
+    static void to_base(core_record const & r, values & v, indicator & ind)
+    {
+        v.set("id", r.id);
+        v.set("n", r.n);
+        v.set("d", r.d);
+        v.set("s", r.s);
+        ind = i_ok;
+    }
+};
+
+} // namespace soci
+
+namespace
+{
+
+// Configure the result set returned by the mock backend: all benchmarks use
+// the same 4 columns corresponding to the fields of core_record.
+void set_result_set(session & sql, std::size_t rows)
+{
+    empty_result_set resultSet;
+    resultSet.rows = rows;
+    resultSet.columns.push_back(dt_integer);
+    resultSet.columns.push_back(dt_long_long);
+    resultSet.columns.push_back(dt_double);
+    resultSet.columns.push_back(dt_string);
+    resultSet.stringSize = 16;
+
+    static_cast<empty_session_backend *>(sql.get_backend())
+        ->set_result_set(resultSet);
+}
+
+// Base class for the benchmarks using a single prepared statement.
+class statement_benchmark : public benchmark
+{
+public:
+    explicit statement_benchmark(char const * name) : benchmark(name) {}
+
+    void teardown(session &) SOCI_OVERRIDE
+    {
+        st_.reset();
+    }
+
+protected:
+    cxx_details::auto_ptr<statement> st_;
+};
+
+// Execute a statement without any data exchange: this measures the fixed
+// per-execute overhead.
+class execute_only : public statement_benchmark
+{
+public:
+    execute_only() : statement_benchmark("execute_only") {}
+
+    void setup(session & sql, bench_options const &) SOCI_OVERRIDE
+    {
+        st_.reset(new statement((sql.prepare << "delete")));
+    }
+
+    void run(int) SOCI_OVERRIDE
+    {
+        st_->execute(true);
+    }
+};
+
+// Create, prepare and execute a new statement every time.
+class one_time_query : public benchmark
+{
+public:
+    one_time_query() : benchmark("one_time_query"), sql_(NULL), id_(0) {}
+
+    void setup(session & sql, bench_options const &) SOCI_OVERRIDE
+    {
+        sql_ = &sql;
+        set_result_set(sql, 1);
+    }
+
+    void run(int) SOCI_OVERRIDE
+    {
+        *sql_ << "select", into(id_);
+    }
+
+private:
+    session * sql_;
+    int id_;
+};
+
+class use_scalar : public statement_benchmark
+{
+public:
+    use_scalar() : statement_benchmark("use_scalar"), id_(0), n_(0), d_(0) {}
+
+    void setup(session & sql, bench_options const &) SOCI_OVERRIDE
+    {
+        s_ = "inserted row";
+        st_.reset(new statement((sql.prepare << "insert",
+            use(id_), use(n_), use(d_), use(s_))));
+    }
+
+    void run(int i) SOCI_OVERRIDE
+    {
+        id_ = i;
+        st_->execute(true);
+    }
+
+private:
+    int id_;
+    long long n_;
+    double d_;
+    std::string s_;
+};
+
+class use_bulk : public statement_benchmark
+{
+public:
+    use_bulk() : statement_benchmark("use_bulk"), batch_(0) {}
+
+    void setup(session & sql, bench_options const & opts) SOCI_OVERRIDE
+    {
+        batch_ = opts.batch;
+        ids_.resize(batch_);
+        ns_.resize(batch_);
+        ds_.resize(batch_);
+        ss_.assign(batch_, "inserted row");
+
+        st_.reset(new statement((sql.prepare << "insert",
+            use(ids_), use(ns_), use(ds_), use(ss_))));
+    }
+
+    void run(int) SOCI_OVERRIDE
+    {
+        st_->execute(true);
+    }
+
+    int rows_per_operation() const SOCI_OVERRIDE { return batch_; }
+
+private:
+    int batch_;
+    std::vector<int> ids_;
+    std::vector<long long> ns_;
+    std::vector<double> ds_;
+    std::vector<std::string> ss_;
+};
+
+// Execute a query returning a single row into scalar into elements.
+class into_scalar : public statement_benchmark
+{
+public:
+    into_scalar() : statement_benchmark("into_scalar"), id_(0), n_(0), d_(0) {}
+
+    void setup(session & sql, bench_options const &) SOCI_OVERRIDE
+    {
+        set_result_set(sql, 1);
+        st_.reset(new statement((sql.prepare << "select",
+            into(id_), into(n_), into(d_), into(s_))));
+    }
+
+    void run(int) SOCI_OVERRIDE
+    {
+        st_->execute(true);
+    }
+
+private:
+    int id_;
+    long long n_;
+    double d_;
+    std::string s_;
+};
+
+// Fetch all rows one by one into scalar into elements: this measures the
+// per-row overhead of fetch().
+class fetch_scalar : public statement_benchmark
+{
+public:
+    fetch_scalar()
+        : statement_benchmark("fetch_scalar"), rows_(0), id_(0), n_(0), d_(0)
+    {}
+
+    void setup(session & sql, bench_options const & opts) SOCI_OVERRIDE
+    {
+        rows_ = opts.rows;
+        set_result_set(sql, rows_);
+        st_.reset(new statement((sql.prepare << "select",
+            into(id_), into(n_), into(d_), into(s_))));
+    }
+
+    void run(int) SOCI_OVERRIDE
+    {
+        st_->execute();
+        while (st_->fetch())
+            ;
+    }
+
+    int rows_per_operation() const SOCI_OVERRIDE { return rows_; }
+
+private:
+    int rows_;
+    int id_;
+    long long n_;
+    double d_;
+    std::string s_;
+};
+
+class fetch_bulk : public statement_benchmark
+{
+public:
+    fetch_bulk() : statement_benchmark("fetch_bulk"), rows_(0), batch_(0) {}
+
+    void setup(session & sql, bench_options const & opts) SOCI_OVERRIDE
+    {
+        rows_ = opts.rows;
+        batch_ = opts.batch;
+        set_result_set(sql, rows_);
+
+        ids_.resize(batch_);
+        ns_.resize(batch_);
+        ds_.resize(batch_);
+        ss_.resize(batch_);
+
+        st_.reset(new statement((sql.prepare << "select",
+            into(ids_), into(ns_), into(ds_), into(ss_))));
+    }
+
+    void run(int) SOCI_OVERRIDE
+    {
+        // The vectors are shrunk by the previous run, restore their size.
+        ids_.resize(batch_);
+        ns_.resize(batch_);
+        ds_.resize(batch_);
+        ss_.resize(batch_);
+
+        st_->execute();
+        while (st_->fetch())
+            ;
+    }
+
+    int rows_per_operation() const SOCI_OVERRIDE { return rows_; }
+
+private:
+    int rows_;
+    int batch_;
+    std::vector<int> ids_;
+    std::vector<long long> ns_;
+    std::vector<double> ds_;
+    std::vector<std::string> ss_;
+};
+
+// Iterate over all rows using rowset<row>: this measures the overhead of
+// describing the columns and constructing the dynamic rows.
+class rowset_row : public benchmark
+{
+public:
+    rowset_row() : benchmark("rowset_row"), sql_(NULL), rows_(0), sum_(0) {}
+
+    void setup(session & sql, bench_options const & opts) SOCI_OVERRIDE
+    {
+        sql_ = &sql;
+        rows_ = opts.rows;
+        set_result_set(sql, rows_);
+    }
+
+    void run(int) SOCI_OVERRIDE
+    {
+        rowset<row> rs = (sql_->prepare << "select");
+        for (rowset<row>::const_iterator it = rs.begin(); it != rs.end(); ++it)
+        {
+            row const & r = *it;
+            sum_ += r.get<int>(0);
+            sum_ += r.get<long long>(1);
+            sum_ += static_cast<long long>(r.get<double>(2));
+            sum_ += r.get<std::string>(3).size();
+        }
+    }
+
+    int rows_per_operation() const SOCI_OVERRIDE { return rows_; }
+
+private:
+    session * sql_;
+    int rows_;
+
+    // Used only to prevent the compiler from optimizing the loop away.
+    long long sum_;
+};
+
+// Iterate over all rows using rowset of a user-defined type.
+class rowset_orm : public benchmark
+{
+public:
+    rowset_orm() : benchmark("rowset_orm"), sql_(NULL), rows_(0), sum_(0) {}
+
+    void setup(session & sql, bench_options const & opts) SOCI_OVERRIDE
+    {
+        sql_ = &sql;
+        rows_ = opts.rows;
+        set_result_set(sql, rows_);
+    }
+
+    void run(int) SOCI_OVERRIDE
+    {
+        rowset<core_record> rs = (sql_->prepare << "select");
+        for (rowset<core_record>::const_iterator it = rs.begin();
+             it != rs.end(); ++it)
+        {
+            sum_ += it->id;
+        }
+    }
+
+    int rows_per_operation() const SOCI_OVERRIDE { return rows_; }
+
+private:
+    session * sql_;
+    int rows_;
+    long long sum_;
+};
+
+class orm_select : public statement_benchmark
+{
+public:
+    orm_select() : statement_benchmark("orm_select") {}
+
+    void setup(session & sql, bench_options const &) SOCI_OVERRIDE
+    {
+        set_result_set(sql, 1);
+        st_.reset(new statement((sql.prepare << "select", into(rec_))));
+    }
+
+    void run(int) SOCI_OVERRIDE
+    {
+        st_->execute(true);
+    }
+
+private:
+    core_record rec_;
+};
+
+} // anonymous namespace
+
+int main(int argc, char ** argv)
+{
+    bench_options opts;
+
+    int exitCode;
+    if (!parse_command_line(argc, argv, opts, NULL, exitCode))
+    {
+        return exitCode;
+    }
+
+    try
+    {
+        session sql(*factory_empty(), opts.connectString);
+
+        execute_only executeOnly;
+        one_time_query oneTimeQuery;
+        use_scalar useScalar;
+        use_bulk useBulk;
+        into_scalar intoScalar;
+        fetch_scalar fetchScalar;
+        fetch_bulk fetchBulk;
+        rowset_row rowsetRow;
+        rowset_orm rowsetOrm;
+        orm_select ormSelect;
+
+        benchmark * const benchmarks[] =
+        {
+            &executeOnly,
+            &oneTimeQuery,
+            &useScalar,
+            &useBulk,
+            &intoScalar,
+            &fetchScalar,
+            &fetchBulk,
+            &rowsetRow,
+            &rowsetOrm,
+            &ormSelect,
+        };
+
+        exitCode = run_benchmarks(sql, opts,
+            benchmarks, sizeof(benchmarks)/sizeof(benchmarks[0]));
+    }
+    catch (std::exception const & e)
+    {
+        std::cerr << "Benchmark failed: " << e.what() << "\n";
+        return EXIT_FAILURE;
+    }
+
+    return exitCode;
+}
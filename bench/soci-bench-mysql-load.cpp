@@ -0,0 +1,200 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Benchmark of loading rows into MySQL using mysql_bulk_loader compared to
+// inserting them using vector use elements.
+//
+// Both benchmarks insert the same --batch rows per operation into the same
+// table, emptied before running each of them, so their rows_per_sec values
+// can be compared directly.
+
+#include "bench-common.h"
+#include "soci/mysql/soci-mysql.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace soci;
+using namespace soci_bench;
+
+namespace
+{
+
+// Base class for both benchmarks, containing the rows to insert.
+class load_base : public benchmark
+{
+public:
+    explicit load_base(char const * name) : benchmark(name), batch_(0) {}
+
+    void setup(session & sql, bench_options const & opts) SOCI_OVERRIDE
+    {
+        sql << "delete from soci_bench";
+
+        batch_ = opts.batch;
+
+        ids_.resize(batch_);
+        ns_.resize(batch_);
+        ds_.resize(batch_);
+        ss_.resize(batch_);
+        inds_.resize(batch_);
+        for (int i = 0; i != batch_; ++i)
+        {
+            ns_[i] = 1000000000LL * i;
+            ds_[i] = i / 3.0;
+
+            std::ostringstream oss;
+            oss << "row number " << i;
+            ss_[i] = oss.str();
+
+            inds_[i] = i % 10 ? i_ok : i_null;
+        }
+    }
+
+    void teardown(session & sql) SOCI_OVERRIDE
+    {
+        sql << "delete from soci_bench";
+    }
+
+    int rows_per_operation() const SOCI_OVERRIDE { return batch_; }
+
+protected:
+    // Use different ids for each operation, as the table has a primary key.
+    void update_ids(int i)
+    {
+        for (int j = 0; j != batch_; ++j)
+        {
+            ids_[j] = i * batch_ + j;
+        }
+    }
+
+    int batch_;
+    std::vector<int> ids_;
+    std::vector<long long> ns_;
+    std::vector<double> ds_;
+    std::vector<std::string> ss_;
+    std::vector<indicator> inds_;
+};
+
+class insert_vector : public load_base
+{
+public:
+    insert_vector() : load_base("insert_vector"), sql_(NULL) {}
+
+    void setup(session & sql, bench_options const & opts) SOCI_OVERRIDE
+    {
+        load_base::setup(sql, opts);
+        sql_ = &sql;
+    }
+
+    void run(int i) SOCI_OVERRIDE
+    {
+        update_ids(i);
+
+        *sql_ << "insert into soci_bench(id, n, d, s) values(:id, :n, :d, :s)",
+            use(ids_), use(ns_), use(ds_), use(ss_, inds_);
+    }
+
+private:
+    session * sql_;
+};
+
+class load_data : public load_base
+{
+public:
+    load_data() : load_base("load_data"), sql_(NULL) {}
+
+    void setup(session & sql, bench_options const & opts) SOCI_OVERRIDE
+    {
+        load_base::setup(sql, opts);
+        sql_ = &sql;
+    }
+
+    void run(int i) SOCI_OVERRIDE
+    {
+        update_ids(i);
+
+        mysql_bulk_loader loader(*sql_, "soci_bench");
+        loader.add("id", ids_);
+        loader.add("n", ns_);
+        loader.add("d", ds_);
+        loader.add("s", ss_, inds_);
+
+        if (loader.load() != batch_ || loader.get_warning_count() != 0)
+        {
+            throw soci_error("Unexpected bulk load result");
+        }
+    }
+
+private:
+    session * sql_;
+};
+
+} // anonymous namespace
+
+int main(int argc, char ** argv)
+{
+    // Use bigger batches by default, as bulk loading is only useful for them.
+    bench_options opts;
+    opts.iterations = 20;
+    opts.warmup = 1;
+    opts.batch = 10000;
+
+    int exitCode;
+    if (!parse_command_line(argc, argv, opts,
+            "Connect string is the MySQL connect string, e.g. "
+            "\"db=soci_test\".\n"
+            "The table \"soci_bench\" in this database is replaced.",
+            exitCode))
+    {
+        return exitCode;
+    }
+
+    if (opts.connectString.empty())
+    {
+        std::cerr << "MySQL connect string must be specified.\n";
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        // Bulk loading requires enabling local infile support, but the option
+        // can't be specified twice.
+        std::string connectString = opts.connectString;
+        if (connectString.find("local_infile") == std::string::npos)
+            connectString += " local_infile=1";
+
+        session sql(*factory_mysql(), connectString);
+
+        sql << "drop table if exists soci_bench";
+        sql << "create table soci_bench(id integer primary key, n bigint, "
+               "d double, s varchar(64))";
+
+        insert_vector insertVector;
+        load_data loadData;
+
+        benchmark * const benchmarks[] =
+        {
+            &insertVector,
+            &loadData,
+        };
+
+        exitCode = run_benchmarks(sql, opts,
+            benchmarks, sizeof(benchmarks)/sizeof(benchmarks[0]));
+
+        sql << "drop table soci_bench";
+    }
+    catch (std::exception const & e)
+    {
+        std::cerr << "Benchmark failed: " << e.what() << "\n";
+        return EXIT_FAILURE;
+    }
+
+    return exitCode;
+}
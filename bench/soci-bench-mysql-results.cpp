@@ -0,0 +1,175 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Benchmark of the different MySQL result modes.
+//
+// This program reads the entire table using vector intos with each of the
+// modes defined by mysql_result_mode enum, so that the rows_per_sec values
+// of the different benchmarks can be compared to choose the best mode for
+// the given result size and batch size.
+
+#include "bench-common.h"
+#include "soci/mysql/soci-mysql.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace soci;
+using namespace soci_bench;
+
+namespace
+{
+
+class select_mode : public benchmark
+{
+public:
+    select_mode(char const * name, mysql_result_mode mode)
+        : benchmark(name), mode_(mode), rows_(0), batch_(0)
+    {
+    }
+
+    void setup(session & sql, bench_options const & opts) SOCI_OVERRIDE
+    {
+        rows_ = opts.rows;
+        batch_ = opts.batch;
+
+        ids_.resize(batch_);
+        ns_.resize(batch_);
+        ss_.resize(batch_);
+
+        st_.reset(new statement((sql.prepare <<
+            "select id, n, s from soci_bench",
+            into(ids_), into(ns_), into(ss_))));
+
+        static_cast<mysql_statement_backend *>(st_->get_backend())
+            ->set_result_mode(mode_);
+    }
+
+    // A single operation reads the entire table, in batches.
+    void run(int) SOCI_OVERRIDE
+    {
+        // The vectors are shrunk by the previous run, restore their size.
+        ids_.resize(batch_);
+        ns_.resize(batch_);
+        ss_.resize(batch_);
+
+        st_->execute();
+        while (st_->fetch())
+            ;
+    }
+
+    void teardown(session &) SOCI_OVERRIDE
+    {
+        st_.reset();
+    }
+
+    int rows_per_operation() const SOCI_OVERRIDE { return rows_; }
+
+private:
+    mysql_result_mode const mode_;
+    cxx_details::auto_ptr<statement> st_;
+    int rows_;
+    int batch_;
+    std::vector<int> ids_;
+    std::vector<long long> ns_;
+    std::vector<std::string> ss_;
+};
+
+void create_table(session & sql, int rows)
+{
+    sql << "drop table if exists soci_bench";
+    sql << "create table soci_bench(id integer primary key, n bigint, "
+           "s varchar(64))";
+
+    // Insert the rows in chunks to avoid exceeding the maximal packet size.
+    int const chunk = 10000;
+
+    std::vector<int> ids;
+    std::vector<long long> ns;
+    std::vector<std::string> ss;
+    for (int start = 0; start < rows; start += chunk)
+    {
+        ids.clear();
+        ns.clear();
+        ss.clear();
+        for (int i = start; i != rows && i != start + chunk; ++i)
+        {
+            ids.push_back(i);
+            ns.push_back(1000000000LL * i);
+
+            std::ostringstream oss;
+            oss << "row number " << i;
+            ss.push_back(oss.str());
+        }
+
+        sql << "insert into soci_bench(id, n, s) values(:id, :n, :s)",
+            use(ids), use(ns), use(ss);
+    }
+}
+
+} // anonymous namespace
+
+int main(int argc, char ** argv)
+{
+    // Use larger results by default, as the differences between the modes
+    // are only significant for them.
+    bench_options opts;
+    opts.iterations = 10;
+    opts.warmup = 1;
+    opts.rows = 100000;
+    opts.batch = 1000;
+
+    int exitCode;
+    if (!parse_command_line(argc, argv, opts,
+            "Connect string is the MySQL connect string, e.g. "
+            "\"db=soci_test\".\n"
+            "The table \"soci_bench\" in this database is replaced.",
+            exitCode))
+    {
+        return exitCode;
+    }
+
+    if (opts.connectString.empty())
+    {
+        std::cerr << "MySQL connect string must be specified.\n";
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        session sql(*factory_mysql(), opts.connectString);
+
+        create_table(sql, opts.rows);
+
+        select_mode selectCursor("select_cursor", mysql_result_cursor);
+        select_mode selectBuffered("select_buffered", mysql_result_buffered);
+        select_mode selectUnbuffered("select_unbuffered",
+                                     mysql_result_unbuffered);
+
+        benchmark * const benchmarks[] =
+        {
+            &selectCursor,
+            &selectBuffered,
+            &selectUnbuffered,
+        };
+
+        exitCode = run_benchmarks(sql, opts,
+            benchmarks, sizeof(benchmarks)/sizeof(benchmarks[0]));
+
+        sql << "drop table soci_bench";
+    }
+    catch (std::exception const & e)
+    {
+        std::cerr << "Benchmark failed: " << e.what() << "\n";
+        return EXIT_FAILURE;
+    }
+
+    return exitCode;
+}
@@ -0,0 +1,345 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Benchmark of concurrent reads from a SQLite database in WAL mode.
+//
+// This program uses sqlite3_wal_pool and runs the same read-only workload
+// using 1, 2, 4, ... reader threads, up to the number given by --threads
+// option, so that the rows_per_sec values of the different benchmarks show
+// how the read throughput scales with the number of threads.
+
+#include "bench-common.h"
+#include "soci/sqlite3/soci-sqlite3.h"
+
+#include <pthread.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace soci;
+using namespace soci_bench;
+
+namespace
+{
+
+char const* const defaultDatabase = "soci_bench_wal.sqlite";
+
+class concurrent_reads;
+
+// Parameters and results of a single reader thread.
+struct reader_data
+{
+    concurrent_reads * owner;
+    unsigned seed;
+    long long sum;
+    std::string error;
+};
+
+// Each run performs the given number of point selects in each of the threads.
+//
+// The threads are started once, in setup(), and each run only wakes them up
+// and waits until all of them are done, so that creating the threads and
+// their sessions is not included in the timings.
+class concurrent_reads : public benchmark
+{
+public:
+    concurrent_reads(char const * name, sqlite3_wal_pool & pool, int threads)
+        : benchmark(name), pool_(pool), threads_(threads), rows_(0),
+          queries_(0), generation_(0), done_(0), stop_(false)
+    {
+        pthread_mutex_init(&mutex_, NULL);
+        pthread_cond_init(&startCond_, NULL);
+        pthread_cond_init(&doneCond_, NULL);
+    }
+
+    ~concurrent_reads() SOCI_OVERRIDE
+    {
+        stop_threads();
+
+        pthread_cond_destroy(&doneCond_);
+        pthread_cond_destroy(&startCond_);
+        pthread_mutex_destroy(&mutex_);
+    }
+
+    void setup(session &, bench_options const & opts) SOCI_OVERRIDE
+    {
+        rows_ = opts.rows;
+        queries_ = opts.batch;
+
+        data_.resize(threads_);
+        for (int t = 0; t != threads_; ++t)
+        {
+            data_[t].owner = this;
+            data_[t].error.clear();
+        }
+
+        generation_ = 0;
+        done_ = 0;
+        stop_ = false;
+
+        threadIds_.reserve(threads_);
+        for (int t = 0; t != threads_; ++t)
+        {
+            pthread_t thread;
+            if (pthread_create(&thread, NULL, reader_thread, &data_[t]) != 0)
+            {
+                stop_threads();
+                throw soci_error("Failed to create reader thread");
+            }
+
+            threadIds_.push_back(thread);
+        }
+
+        // Wait until all threads have created their sessions.
+        pthread_mutex_lock(&mutex_);
+        while (done_ != threads_)
+        {
+            pthread_cond_wait(&doneCond_, &mutex_);
+        }
+        pthread_mutex_unlock(&mutex_);
+
+        check_errors();
+    }
+
+    void run(int i) SOCI_OVERRIDE
+    {
+        pthread_mutex_lock(&mutex_);
+        for (int t = 0; t != threads_; ++t)
+        {
+            data_[t].seed = static_cast<unsigned>(i * threads_ + t);
+            data_[t].sum = 0;
+        }
+
+        done_ = 0;
+        ++generation_;
+        pthread_cond_broadcast(&startCond_);
+
+        while (done_ != threads_)
+        {
+            pthread_cond_wait(&doneCond_, &mutex_);
+        }
+        pthread_mutex_unlock(&mutex_);
+
+        check_errors();
+    }
+
+    void teardown(session &) SOCI_OVERRIDE
+    {
+        stop_threads();
+    }
+
+    int rows_per_operation() const SOCI_OVERRIDE
+    {
+        return threads_ * queries_;
+    }
+
+private:
+    static void * reader_thread(void * arg)
+    {
+        reader_data & data = *static_cast<reader_data *>(arg);
+        data.owner->read(data);
+        return NULL;
+    }
+
+    void read(reader_data & data)
+    {
+        // Errors are reported by the runs, so the thread keeps taking part
+        // in them even if it fails to create its session.
+        session * sql = NULL;
+        statement * st = NULL;
+        int id = 0;
+        long long n = 0;
+        try
+        {
+            sql = new session(pool_.readers());
+            st = new statement((sql->prepare <<
+                "select n from soci_bench where id = :id", use(id), into(n)));
+        }
+        catch (std::exception const & e)
+        {
+            data.error = e.what();
+        }
+
+        int generation = 0;
+        for (;;)
+        {
+            pthread_mutex_lock(&mutex_);
+            ++done_;
+            pthread_cond_signal(&doneCond_);
+            while (generation_ == generation && !stop_)
+            {
+                pthread_cond_wait(&startCond_, &mutex_);
+            }
+            generation = generation_;
+            bool const stop = stop_;
+            pthread_mutex_unlock(&mutex_);
+
+            if (stop)
+                break;
+
+            if (!data.error.empty())
+                continue;
+
+            try
+            {
+                for (int i = 0; i != queries_; ++i)
+                {
+                    // Simple LCG, as rand() is not thread-safe.
+                    data.seed = data.seed * 1103515245u + 12345u;
+                    id = static_cast<int>((data.seed >> 8) % rows_);
+
+                    st->execute(true);
+                    data.sum += n;
+                }
+            }
+            catch (std::exception const & e)
+            {
+                data.error = e.what();
+            }
+        }
+
+        delete st;
+        delete sql;
+    }
+
+    void check_errors()
+    {
+        for (int t = 0; t != threads_; ++t)
+        {
+            if (!data_[t].error.empty())
+            {
+                throw soci_error("Reader thread failed: " + data_[t].error);
+            }
+        }
+    }
+
+    // Stop and join all the threads started so far, if any.
+    void stop_threads()
+    {
+        if (threadIds_.empty())
+            return;
+
+        pthread_mutex_lock(&mutex_);
+        stop_ = true;
+        pthread_cond_broadcast(&startCond_);
+        pthread_mutex_unlock(&mutex_);
+
+        for (std::size_t t = 0; t != threadIds_.size(); ++t)
+        {
+            pthread_join(threadIds_[t], NULL);
+        }
+
+        threadIds_.clear();
+    }
+
+    sqlite3_wal_pool & pool_;
+    int const threads_;
+    int rows_;
+    int queries_;
+
+    std::vector<reader_data> data_;
+    std::vector<pthread_t> threadIds_;
+
+    // Protects the fields below and data_ elements while the threads run.
+    pthread_mutex_t mutex_;
+    pthread_cond_t startCond_;
+    pthread_cond_t doneCond_;
+
+    int generation_; // incremented to start a new run
+    int done_;       // number of threads which finished the current run
+    bool stop_;      // set to stop the threads
+};
+
+void create_table(session & sql, int rows)
+{
+    sql << "drop table if exists soci_bench";
+    sql << "create table soci_bench(id integer primary key, n integer)";
+
+    std::vector<int> ids(rows);
+    std::vector<long long> ns(rows);
+    for (int i = 0; i != rows; ++i)
+    {
+        ids[i] = i;
+        ns[i] = i * 7LL;
+    }
+
+    sql << "insert into soci_bench(id, n) values(:id, :n)", use(ids), use(ns);
+}
+
+} // anonymous namespace
+
+int main(int argc, char ** argv)
+{
+    bench_options opts;
+    opts.connectString = defaultDatabase;
+
+    int exitCode;
+    if (!parse_command_line(argc, argv, opts,
+            "Connect string is the SQLite database file name or SQLite\n"
+            "connect string, \"soci_bench_wal.sqlite\" is used by default.\n"
+            "The database is created if necessary and the table\n"
+            "\"soci_bench\" in it is replaced.", exitCode))
+    {
+        return exitCode;
+    }
+
+    try
+    {
+        sqlite3_wal_pool pool(opts.connectString, opts.threads);
+
+        session sql(pool.writer());
+        create_table(sql, opts.rows);
+
+        // The benchmarks store the pointers to their names, so keep the
+        // names alive and don't let the vector reallocate.
+        std::vector<std::string> names;
+        names.reserve(opts.threads);
+
+        std::vector<concurrent_reads *> readers;
+        for (int threads = 1; ; threads *= 2)
+        {
+            if (threads > opts.threads)
+                threads = opts.threads;
+
+            std::ostringstream oss;
+            oss << "read_" << threads << (threads == 1 ? "_thread" : "_threads");
+            names.push_back(oss.str());
+
+            readers.push_back(
+                new concurrent_reads(names.back().c_str(), pool, threads));
+
+            if (threads == opts.threads)
+                break;
+        }
+
+        std::vector<benchmark *> benchmarks(readers.begin(), readers.end());
+        exitCode = run_benchmarks(sql, opts, &benchmarks[0], benchmarks.size());
+
+        for (std::size_t i = 0; i != readers.size(); ++i)
+        {
+            delete readers[i];
+        }
+
+        sql << "drop table soci_bench";
+    }
+    catch (std::exception const & e)
+    {
+        std::cerr << "Benchmark failed: " << e.what() << "\n";
+        return EXIT_FAILURE;
+    }
+
+    if (opts.connectString == defaultDatabase)
+    {
+        std::remove(defaultDatabase);
+    }
+
+    return exitCode;
+}
@@ -0,0 +1,581 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Benchmarks of the most commonly used SOCI operations.
+//
+// This program can be used with any backend, which is loaded dynamically, and
+// outputs the results in JSON format to allow comparing them between runs.
+// Run it with "--help" option for the usage information.
+
+#include "bench-common.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace soci;
+using namespace soci_bench;
+
+namespace
+{
+
+// Record used for benchmarking the type_conversion<> mapping.
+struct bench_record
+{
+    int id;
+    long long n;
+    double d;
+    std::string s;
+};
+
+// Column types depend on the backend, e.g. "bigint" is mapped to dt_integer
+// by some of them, so get the integer values in a type-independent way.
+template <typename Row, typename Key>
+long long get_integer(Row const & r, Key const & key)
+{
+    switch (r.get_properties(key).get_data_type())
+    {
+        case dt_integer:
+            return r.template get<int>(key);
+        case dt_long_long:
+            return r.template get<long long>(key);
+        case dt_unsigned_long_long:
+            return static_cast<long long>(
+                r.template get<unsigned long long>(key));
+        case dt_double:
+            return static_cast<long long>(r.template get<double>(key));
+        default:
+            throw soci_error("Unexpected integer column type");
+    }
+}
+
+} // anonymous namespace
+
+namespace soci
+{
+
+template<>
+struct type_conversion<bench_record>
+{
+    typedef values base_type;
+
+    static void from_base(values const & v, indicator /* ind */,
+        bench_record & r)
+    {
+        // This is also called after using the record for an insert, there is
+        // nothing to do in this case as it can't be modified by it.
+        if (v.get_number_of_columns() == 0)
+        {
+            return;
+        }
+
+        r.id = static_cast<int>(get_integer(v, std::string("ID")));
+        r.n = get_integer(v, std::string("N"));
+        r.d = v.get<double>("D");
+        r.s = v.get<std::string>("S");
+    }
+
+    static void to_base(bench_record const & r, values & v, indicator & ind)
+    {
+        v.set("id", r.id);
+        v.set("n", r.n);
+        v.set("d", r.d);
+        v.set("s", r.s);
+        ind = i_ok;
+    }
+};
+
+} // namespace soci
+
+namespace
+{
+
+void create_tables(session & sql)
+{
+    try { sql.drop_table("soci_bench"); } catch (soci_error const &) {}
+    try { sql.drop_table("soci_bench_blob"); } catch (soci_error const &) {}
+
+    sql.create_table("soci_bench")
+        .column("id", dt_integer)
+        .column("n", dt_long_long)
+        .column("d", dt_double)
+        .column("s", dt_string, 64);
+
+    sql.create_table("soci_bench_blob")
+        .column("id", dt_integer)
+        .column("b", dt_blob);
+}
+
+void drop_tables(session & sql)
+{
+    sql.drop_table("soci_bench_blob");
+    sql.drop_table("soci_bench");
+}
+
+// Fill the main table with the given number of rows.
+void populate(session & sql, int rows)
+{
+    sql << "delete from soci_bench";
+
+    std::vector<int> ids(rows);
+    std::vector<long long> ns(rows);
+    std::vector<double> ds(rows);
+    std::vector<std::string> ss(rows);
+    for (int i = 0; i != rows; ++i)
+    {
+        ids[i] = i;
+        ns[i] = 1000000000LL * i;
+        ds[i] = i / 3.0;
+
+        std::ostringstream oss;
+        oss << "row number " << i;
+        ss[i] = oss.str();
+    }
+
+    transaction tr(sql);
+    sql << "insert into soci_bench(id, n, d, s) values(:id, :n, :d, :s)",
+        use(ids), use(ns), use(ds), use(ss);
+    tr.commit();
+}
+
+class insert_single : public benchmark
+{
+public:
+    insert_single() : benchmark("insert_single"), n_(0), d_(0) {}
+
+    void setup(session & sql, bench_options const &) SOCI_OVERRIDE
+    {
+        sql << "delete from soci_bench";
+
+        s_ = "inserted row";
+        st_.reset(new statement((sql.prepare <<
+            "insert into soci_bench(id, n, d, s) values(:id, :n, :d, :s)",
+            use(id_), use(n_), use(d_), use(s_))));
+    }
+
+    void run(int i) SOCI_OVERRIDE
+    {
+        id_ = i;
+        n_ = i;
+        d_ = i;
+        st_->execute(true);
+    }
+
+    void teardown(session &) SOCI_OVERRIDE
+    {
+        st_.reset();
+    }
+
+private:
+    cxx_details::auto_ptr<statement> st_;
+    int id_;
+    long long n_;
+    double d_;
+    std::string s_;
+};
+
+class insert_bulk : public benchmark
+{
+public:
+    insert_bulk() : benchmark("insert_bulk"), batch_(0) {}
+
+    void setup(session & sql, bench_options const & opts) SOCI_OVERRIDE
+    {
+        sql << "delete from soci_bench";
+
+        batch_ = opts.batch;
+        ids_.resize(batch_);
+        ns_.resize(batch_);
+        ds_.resize(batch_);
+        ss_.assign(batch_, "inserted row");
+
+        st_.reset(new statement((sql.prepare <<
+            "insert into soci_bench(id, n, d, s) values(:id, :n, :d, :s)",
+            use(ids_), use(ns_), use(ds_), use(ss_))));
+    }
+
+    void run(int i) SOCI_OVERRIDE
+    {
+        for (int j = 0; j != batch_; ++j)
+        {
+            ids_[j] = i * batch_ + j;
+            ns_[j] = j;
+            ds_[j] = j;
+        }
+
+        st_->execute(true);
+    }
+
+    void teardown(session &) SOCI_OVERRIDE
+    {
+        st_.reset();
+    }
+
+    int rows_per_operation() const SOCI_OVERRIDE { return batch_; }
+
+private:
+    cxx_details::auto_ptr<statement> st_;
+    int batch_;
+    std::vector<int> ids_;
+    std::vector<long long> ns_;
+    std::vector<double> ds_;
+    std::vector<std::string> ss_;
+};
+
+class select_single : public benchmark
+{
+public:
+    select_single() : benchmark("select_single"), rows_(0), n_(0), d_(0) {}
+
+    void setup(session & sql, bench_options const & opts) SOCI_OVERRIDE
+    {
+        rows_ = opts.rows;
+        populate(sql, rows_);
+
+        st_.reset(new statement((sql.prepare <<
+            "select n, d, s from soci_bench where id = :id",
+            into(n_), into(d_), into(s_), use(id_))));
+    }
+
+    void run(int i) SOCI_OVERRIDE
+    {
+        id_ = i % rows_;
+        st_->execute(true);
+    }
+
+    void teardown(session &) SOCI_OVERRIDE
+    {
+        st_.reset();
+    }
+
+private:
+    cxx_details::auto_ptr<statement> st_;
+    int rows_;
+    int id_;
+    long long n_;
+    double d_;
+    std::string s_;
+};
+
+class select_bulk : public benchmark
+{
+public:
+    select_bulk() : benchmark("select_bulk"), rows_(0), batch_(0) {}
+
+    void setup(session & sql, bench_options const & opts) SOCI_OVERRIDE
+    {
+        rows_ = opts.rows;
+        batch_ = opts.batch;
+        populate(sql, rows_);
+
+        ids_.resize(batch_);
+        ns_.resize(batch_);
+        ds_.resize(batch_);
+        ss_.resize(batch_);
+
+        st_.reset(new statement((sql.prepare <<
+            "select id, n, d, s from soci_bench",
+            into(ids_), into(ns_), into(ds_), into(ss_))));
+    }
+
+    // A single operation reads the entire table, in batches.
+    void run(int) SOCI_OVERRIDE
+    {
+        // The vectors are shrunk by the previous run, restore their size.
+        ids_.resize(batch_);
+        ns_.resize(batch_);
+        ds_.resize(batch_);
+        ss_.resize(batch_);
+
+        st_->execute();
+        while (st_->fetch())
+            ;
+    }
+
+    void teardown(session &) SOCI_OVERRIDE
+    {
+        st_.reset();
+    }
+
+    int rows_per_operation() const SOCI_OVERRIDE { return rows_; }
+
+private:
+    cxx_details::auto_ptr<statement> st_;
+    int rows_;
+    int batch_;
+    std::vector<int> ids_;
+    std::vector<long long> ns_;
+    std::vector<double> ds_;
+    std::vector<std::string> ss_;
+};
+
+class rowset_row : public benchmark
+{
+public:
+    rowset_row() : benchmark("rowset_row"), sql_(NULL), rows_(0), sum_(0) {}
+
+    void setup(session & sql, bench_options const & opts) SOCI_OVERRIDE
+    {
+        sql_ = &sql;
+        rows_ = opts.rows;
+        populate(sql, rows_);
+    }
+
+    // A single operation reads the entire table.
+    void run(int) SOCI_OVERRIDE
+    {
+        rowset<row> rs = (sql_->prepare << "select id, n, d, s from soci_bench");
+        for (rowset<row>::const_iterator it = rs.begin(); it != rs.end(); ++it)
+        {
+            row const & r = *it;
+            sum_ += get_integer(r, 0);
+            sum_ += get_integer(r, 1);
+            sum_ += static_cast<long long>(r.get<double>(2));
+            sum_ += r.get<std::string>(3).size();
+        }
+    }
+
+    int rows_per_operation() const SOCI_OVERRIDE { return rows_; }
+
+private:
+    session * sql_;
+    int rows_;
+
+    // Used only to prevent the compiler from optimizing the loop away.
+    long long sum_;
+};
+
+class orm_insert : public benchmark
+{
+public:
+    orm_insert() : benchmark("orm_insert") {}
+
+    void setup(session & sql, bench_options const &) SOCI_OVERRIDE
+    {
+        sql << "delete from soci_bench";
+
+        rec_.s = "inserted row";
+        st_.reset(new statement((sql.prepare <<
+            "insert into soci_bench(id, n, d, s) values(:id, :n, :d, :s)",
+            use(rec_))));
+    }
+
+    void run(int i) SOCI_OVERRIDE
+    {
+        rec_.id = i;
+        rec_.n = i;
+        rec_.d = i;
+        st_->execute(true);
+    }
+
+    void teardown(session &) SOCI_OVERRIDE
+    {
+        st_.reset();
+    }
+
+private:
+    cxx_details::auto_ptr<statement> st_;
+    bench_record rec_;
+};
+
+class orm_select : public benchmark
+{
+public:
+    orm_select() : benchmark("orm_select"), rows_(0) {}
+
+    void setup(session & sql, bench_options const & opts) SOCI_OVERRIDE
+    {
+        rows_ = opts.rows;
+        populate(sql, rows_);
+
+        st_.reset(new statement((sql.prepare <<
+            "select id, n, d, s from soci_bench where id = :id",
+            into(rec_), use(id_))));
+    }
+
+    void run(int i) SOCI_OVERRIDE
+    {
+        id_ = i % rows_;
+        st_->execute(true);
+    }
+
+    void teardown(session &) SOCI_OVERRIDE
+    {
+        st_.reset();
+    }
+
+private:
+    cxx_details::auto_ptr<statement> st_;
+    int rows_;
+    int id_;
+    bench_record rec_;
+};
+
+// Blob benchmarks run inside a transaction as some backends require it.
+class blob_write : public benchmark
+{
+public:
+    blob_write() : benchmark("blob_write"), sql_(NULL) {}
+
+    void setup(session & sql, bench_options const & opts) SOCI_OVERRIDE
+    {
+        sql_ = &sql;
+        data_.assign(opts.blobSize, 'x');
+
+        sql << "delete from soci_bench_blob";
+        sql.begin();
+    }
+
+    void run(int i) SOCI_OVERRIDE
+    {
+        blob b(*sql_);
+        b.append(&data_[0], data_.size());
+        *sql_ << "insert into soci_bench_blob(id, b) values(:id, :b)",
+            use(i), use(b);
+    }
+
+    void teardown(session & sql) SOCI_OVERRIDE
+    {
+        sql.commit();
+    }
+
+private:
+    session * sql_;
+    std::vector<char> data_;
+};
+
+class blob_read : public benchmark
+{
+public:
+    blob_read()
+        : benchmark("blob_read"), sql_(NULL), rows_(0), fromStart_(true) {}
+
+    void setup(session & sql, bench_options const & opts) SOCI_OVERRIDE
+    {
+        sql_ = &sql;
+        rows_ = std::min(opts.rows, opts.iterations);
+        data_.assign(opts.blobSize, 'x');
+
+        sql << "delete from soci_bench_blob";
+        sql.begin();
+
+        for (int i = 0; i != rows_; ++i)
+        {
+            blob b(sql);
+            b.append(&data_[0], data_.size());
+            sql << "insert into soci_bench_blob(id, b) values(:id, :b)",
+                use(i), use(b);
+        }
+
+        // Not all backends implement read_from_start(), but those that don't
+        // use 0-based offsets in read(), so fall back to it for them.
+        blob b(sql);
+        sql << "select b from soci_bench_blob where id = 0", into(b);
+        try
+        {
+            b.read_from_start(&data_[0], data_.size());
+        }
+        catch (soci_error const &)
+        {
+            fromStart_ = false;
+        }
+    }
+
+    void run(int i) SOCI_OVERRIDE
+    {
+        blob b(*sql_);
+        int const id = i % rows_;
+        *sql_ << "select b from soci_bench_blob where id = :id",
+            into(b), use(id);
+
+        if (fromStart_)
+        {
+            b.read_from_start(&data_[0], data_.size());
+        }
+        else
+        {
+            b.read(0, &data_[0], data_.size());
+        }
+    }
+
+    void teardown(session & sql) SOCI_OVERRIDE
+    {
+        sql.commit();
+    }
+
+private:
+    session * sql_;
+    int rows_;
+    bool fromStart_;
+    std::vector<char> data_;
+};
+
+} // anonymous namespace
+
+int main(int argc, char ** argv)
+{
+    bench_options opts;
+    opts.connectString = "sqlite3://db=:memory:";
+
+    int exitCode;
+    if (!parse_command_line(argc, argv, opts,
+            "Default connect string is \"sqlite3://db=:memory:\".", exitCode))
+    {
+        return exitCode;
+    }
+
+#ifdef SOCI_BENCH_BACKENDS_PATH
+    dynamic_backends::search_paths().insert(
+        dynamic_backends::search_paths().begin(), SOCI_BENCH_BACKENDS_PATH);
+#endif
+
+    try
+    {
+        session sql(opts.connectString);
+        sql.uppercase_column_names(true);
+
+        create_tables(sql);
+
+        insert_single insertSingle;
+        insert_bulk insertBulk;
+        select_single selectSingle;
+        select_bulk selectBulk;
+        rowset_row rowsetRow;
+        orm_insert ormInsert;
+        orm_select ormSelect;
+        blob_write blobWrite;
+        blob_read blobRead;
+
+        benchmark * const benchmarks[] =
+        {
+            &insertSingle,
+            &insertBulk,
+            &selectSingle,
+            &selectBulk,
+            &rowsetRow,
+            &ormInsert,
+            &ormSelect,
+            &blobWrite,
+            &blobRead,
+        };
+
+        exitCode = run_benchmarks(sql, opts,
+            benchmarks, sizeof(benchmarks)/sizeof(benchmarks[0]));
+
+        drop_tables(sql);
+    }
+    catch (std::exception const & e)
+    {
+        std::cerr << "Benchmark failed: " << e.what() << "\n";
+        return EXIT_FAILURE;
+    }
+
+    return exitCode;
+}
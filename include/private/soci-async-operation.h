@@ -0,0 +1,86 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SOCI_PRIVATE_SOCI_ASYNC_OPERATION_H_INCLUDED
+#define SOCI_PRIVATE_SOCI_ASYNC_OPERATION_H_INCLUDED
+
+#include "soci/soci-backend.h"
+
+namespace soci
+{
+
+namespace details
+{
+
+class statement_impl;
+
+// The operation referenced by async_result.
+//
+// It uses the native asynchronous support of the backend if available, see
+// statement_backend::send_execute(), or calls the backend execute() or fetch()
+// function from a worker thread otherwise. In both cases, the result is
+// processed by statement_impl in get(), i.e. in the thread calling it.
+class async_operation
+{
+public:
+    enum kind
+    {
+        op_execute,
+        op_fetch
+    };
+
+    // Start the operation, num is the value returned by start_execute() or
+    // start_fetch() of the statement, which is kept alive while the operation
+    // exists. If gotData is non-NULL, the result is also stored in it by get().
+    async_operation(statement_impl & st, kind k, int num, long long startTime,
+                    bool * gotData);
+    ~async_operation();
+
+    // Reference counting used by async_result, which is not thread-safe.
+    void add_ref() { ++refCount_; }
+    bool release() { return --refCount_ == 0; }
+
+    bool is_ready();
+    bool get();
+
+    // Stop updating gotData passed to the ctor, if it's the same pointer.
+    void forget_got_data(bool * gotData)
+    {
+        if (gotData_ == gotData)
+            gotData_ = NULL;
+    }
+
+private:
+    // Wait until the operation completes and return its backend result.
+    statement_backend::exec_fetch_result wait();
+
+    // State of the worker thread used if the backend doesn't support
+    // asynchronous operations natively.
+    class worker;
+
+    statement_impl & st_;
+    kind const kind_;
+    int const num_;
+    long long const startTime_;
+    bool * gotData_;
+
+    int refCount_;
+
+    // Set to true once the backend result was retrieved.
+    bool done_;
+
+    // NULL if the backend supports this operation natively.
+    worker * worker_;
+
+    SOCI_NOT_COPYABLE(async_operation)
+};
+
+} // namespace details
+
+} // namespace soci
+
+#endif // SOCI_PRIVATE_SOCI_ASYNC_OPERATION_H_INCLUDED
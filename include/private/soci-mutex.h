@@ -0,0 +1,63 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SOCI_PRIVATE_SOCI_MUTEX_H_INCLUDED
+#define SOCI_PRIVATE_SOCI_MUTEX_H_INCLUDED
+
+#include "soci/soci-platform.h"
+
+// Minimal portable mutex support used by the library implementation.
+
+#ifdef _WIN32
+
+#include <windows.h>
+
+typedef CRITICAL_SECTION soci_mutex_t;
+
+#define LOCK(x) EnterCriticalSection(x)
+#define UNLOCK(x) LeaveCriticalSection(x)
+#define MUTEX_INIT(x) InitializeCriticalSection(x)
+#define MUTEX_DEST(x) DeleteCriticalSection(x)
+
+#else
+
+#include <pthread.h>
+
+typedef pthread_mutex_t soci_mutex_t;
+
+#define LOCK(x) pthread_mutex_lock(x)
+#define UNLOCK(x) pthread_mutex_unlock(x)
+#define MUTEX_INIT(x) pthread_mutex_init(x, NULL)
+#define MUTEX_DEST(x) pthread_mutex_destroy(x)
+
+#endif // _WIN32
+
+namespace soci
+{
+
+namespace details
+{
+
+// Locks the given mutex, which must have been initialized with MUTEX_INIT(),
+// during its lifetime.
+class scoped_lock
+{
+public:
+    explicit scoped_lock(soci_mutex_t * m) : m_(m) { LOCK(m_); }
+    ~scoped_lock() { UNLOCK(m_); }
+
+private:
+    soci_mutex_t * m_;
+
+    SOCI_NOT_COPYABLE(scoped_lock)
+};
+
+} // namespace details
+
+} // namespace soci
+
+#endif // SOCI_PRIVATE_SOCI_MUTEX_H_INCLUDED
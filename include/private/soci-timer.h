@@ -0,0 +1,57 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SOCI_PRIVATE_SOCI_TIMER_H_INCLUDED
+#define SOCI_PRIVATE_SOCI_TIMER_H_INCLUDED
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+namespace soci
+{
+
+namespace details
+{
+
+// Return the current value of a monotonic clock in nanoseconds.
+//
+// The absolute value is meaningless, only the differences between the values
+// returned by two calls to this function should be used.
+inline
+long long monotonic_nanoseconds()
+{
+#ifdef _WIN32
+    static LARGE_INTEGER frequency = { { 0, 0 } };
+    if (frequency.QuadPart == 0)
+    {
+        QueryPerformanceFrequency(&frequency);
+    }
+
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+
+    // Split the computation to avoid overflowing for big counter values.
+    long long const seconds = counter.QuadPart / frequency.QuadPart;
+    long long const rest = counter.QuadPart % frequency.QuadPart;
+
+    return seconds * 1000000000LL + rest * 1000000000LL / frequency.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return static_cast<long long>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+#endif
+}
+
+} // namespace details
+
+} // namespace soci
+
+#endif // SOCI_PRIVATE_SOCI_TIMER_H_INCLUDED
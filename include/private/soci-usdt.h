@@ -0,0 +1,99 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SOCI_PRIVATE_SOCI_USDT_H_INCLUDED
+#define SOCI_PRIVATE_SOCI_USDT_H_INCLUDED
+
+// USDT (user-level statically defined tracing) probes, enabled by building
+// with SOCI_USDT=ON CMake option, which defines SOCI_HAVE_USDT.
+//
+// All probes use "soci" provider and can be used with any tool supporting
+// SystemTap SDT notes, e.g. perf, bpftrace or SystemTap itself. Each probe
+// has an associated semaphore, which is non-zero only while a tracer is
+// attached to it, and SOCI_PROBE_ENABLED() should be used to avoid computing
+// any expensive arguments, such as durations, when it is not.
+//
+// When adding a new probe, don't forget to define its semaphore below.
+
+#ifdef SOCI_HAVE_USDT
+
+#define _SDT_HAS_SEMAPHORES 1
+#include <sys/sdt.h>
+
+#define SOCI_USDT_SEMAPHORE(name) soci_##name##_semaphore
+
+#define SOCI_DECLARE_PROBE(name) \
+    extern "C" volatile unsigned short SOCI_USDT_SEMAPHORE(name)
+
+// This is used in exactly one translation unit to define the semaphores.
+#define SOCI_DEFINE_PROBE(name) \
+    extern "C" { \
+        volatile unsigned short SOCI_USDT_SEMAPHORE(name) \
+            __attribute__((section(".probes"))) = 0; \
+    }
+
+#define SOCI_PROBE_ENABLED(name) \
+    __builtin_expect(SOCI_USDT_SEMAPHORE(name) != 0, 0)
+
+#define SOCI_PROBE1(name, a1) \
+    STAP_PROBE1(soci, name, a1)
+#define SOCI_PROBE2(name, a1, a2) \
+    STAP_PROBE2(soci, name, a1, a2)
+#define SOCI_PROBE3(name, a1, a2, a3) \
+    STAP_PROBE3(soci, name, a1, a2, a3)
+#define SOCI_PROBE4(name, a1, a2, a3, a4) \
+    STAP_PROBE4(soci, name, a1, a2, a3, a4)
+
+// statement_impl: statement pointer, query, backend preparation duration.
+SOCI_DECLARE_PROBE(prepare);
+
+// statement_impl: statement pointer, query.
+SOCI_DECLARE_PROBE(execute_begin);
+
+// statement_impl: statement pointer, query, number of rows fetched and
+// duration of execution in nanoseconds.
+SOCI_DECLARE_PROBE(execute_end);
+
+// statement_impl: statement pointer, query, number of rows fetched and
+// duration of fetching in nanoseconds.
+SOCI_DECLARE_PROBE(fetch);
+
+// connection_pool: pool pointer and timeout in milliseconds (negative if
+// none), only triggered if there is no free session in the pool.
+SOCI_DECLARE_PROBE(pool_lease_wait);
+
+// connection_pool: pool pointer, position of the leased session and time
+// spent waiting for it in nanoseconds.
+SOCI_DECLARE_PROBE(pool_lease_acquire);
+
+// connection_pool: pool pointer and position of the returned session.
+SOCI_DECLARE_PROBE(pool_lease_release);
+
+// session: session pointer and, except for begin, duration in nanoseconds.
+SOCI_DECLARE_PROBE(transaction_begin);
+SOCI_DECLARE_PROBE(transaction_commit);
+SOCI_DECLARE_PROBE(transaction_rollback);
+
+#else // !SOCI_HAVE_USDT
+
+#define SOCI_PROBE_ENABLED(name) false
+
+// Use sizeof() to avoid evaluating the arguments while still avoiding the
+// warnings about the variables used only in them being unused.
+#define SOCI_PROBE1(name, a1) \
+    do { (void)sizeof(a1); } while (0)
+#define SOCI_PROBE2(name, a1, a2) \
+    do { (void)sizeof(a1); (void)sizeof(a2); } while (0)
+#define SOCI_PROBE3(name, a1, a2, a3) \
+    do { (void)sizeof(a1); (void)sizeof(a2); (void)sizeof(a3); } while (0)
+#define SOCI_PROBE4(name, a1, a2, a3, a4) \
+    do { (void)sizeof(a1); (void)sizeof(a2); (void)sizeof(a3); \
+         (void)sizeof(a4); } while (0)
+
+#endif // SOCI_HAVE_USDT/!SOCI_HAVE_USDT
+
+#endif // SOCI_PRIVATE_SOCI_USDT_H_INCLUDED
@@ -0,0 +1,95 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SOCI_ASYNC_LOGGER_H_INCLUDED
+#define SOCI_ASYNC_LOGGER_H_INCLUDED
+
+#include "soci/logger.h"
+
+// std
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+namespace soci
+{
+
+// Logger implementation which never blocks the thread executing the queries.
+//
+// The queries are copied into a fixed-size ring buffer and written to the
+// output stream by a background thread. If the buffer is full, i.e. the
+// queries are logged faster than they can be written, the new queries are
+// dropped instead of waiting and the number of dropped queries is counted.
+// The memory used by the logger is bounded by capacity * maxQueryLength and
+// longer queries are truncated.
+//
+// All the copies of this logger (each session using it has its own copy)
+// share the same buffer, background thread and output stream, so the
+// statistics returned by the accessors below are global for all of them.
+// Only get_last_query() is specific to each copy and so to each session.
+//
+// Example:
+//
+//     soci::async_logger_impl * const impl
+//         = new soci::async_logger_impl("queries.log");
+//     soci::logger const log(impl);
+//     sql.set_logger(log);
+//     ...
+//     std::cout << impl->get_dropped_count() << " queries were dropped\n";
+class SOCI_DECL async_logger_impl : public logger_impl
+{
+public:
+    // Create a logger without any output: set_stream() must be called to
+    // actually start logging the queries, just as with the default logger.
+    explicit async_logger_impl(std::size_t capacity = 4096,
+        std::size_t maxQueryLength = 1024);
+
+    // Create a logger appending the queries to the given file, an exception
+    // is thrown if it can't be opened.
+    explicit async_logger_impl(std::string const & fileName,
+        std::size_t capacity = 4096, std::size_t maxQueryLength = 1024);
+
+    ~async_logger_impl();
+
+    void start_query(std::string const & query) SOCI_OVERRIDE;
+
+    // Change the output stream, which is not owned by the logger and must
+    // remain valid until it is changed again or the logger is destroyed. All
+    // the queries logged before the call are written to the previous stream.
+    // NULL can be passed to disable logging.
+    void set_stream(std::ostream * s) SOCI_OVERRIDE;
+    std::ostream * get_stream() const SOCI_OVERRIDE;
+
+    std::string get_last_query() const SOCI_OVERRIDE;
+
+    // Block until all the queries logged so far are written and the output
+    // stream is flushed.
+    void flush();
+
+    // Number of queries written to the output stream so far.
+    unsigned long long get_logged_count() const;
+
+    // Number of queries dropped because the buffer was full.
+    unsigned long long get_dropped_count() const;
+
+    // Number of queries which were truncated to maxQueryLength.
+    unsigned long long get_truncated_count() const;
+
+private:
+    class async_log_queue;
+
+    explicit async_logger_impl(async_log_queue * queue);
+
+    logger_impl * do_clone() const SOCI_OVERRIDE;
+
+    async_log_queue * queue_;
+    std::string lastQuery_;
+};
+
+} // namespace soci
+
+#endif // SOCI_ASYNC_LOGGER_H_INCLUDED
@@ -0,0 +1,71 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SOCI_ASYNC_RESULT_H_INCLUDED
+#define SOCI_ASYNC_RESULT_H_INCLUDED
+
+#include "soci/soci-platform.h"
+
+namespace soci
+{
+
+namespace details
+{
+
+class async_operation;
+
+} // namespace details
+
+// Handle for the result of statement::execute_async() or fetch_async().
+//
+// The operation is started when the handle is created and its result is
+// retrieved by calling get(), which blocks until the operation completes and
+// then returns the same value, or throws the same exception, as the
+// synchronous function would. is_ready() can be used to check whether get()
+// would block without blocking itself: when using an event loop, it should be
+// called whenever session::native_socket() becomes readable.
+//
+// The session used by the statement must not be used for anything else until
+// get() is called. If the handle is destroyed without calling get(), the
+// operation is waited for and its result, including any errors, is discarded.
+//
+// Example:
+//
+//     soci::async_result res = st.execute_async(true);
+//     while (!res.is_ready())
+//     {
+//         // Do something else, e.g. wait for sql.native_socket().
+//     }
+//     bool const gotData = res.get();
+//
+// Copies of the handle refer to the same operation.
+class SOCI_DECL async_result
+{
+public:
+    // This ctor is used by statement_impl only, the handle takes ownership
+    // of the operation.
+    explicit async_result(details::async_operation * op);
+
+    async_result(async_result const & other);
+    async_result & operator=(async_result const & other);
+
+    ~async_result();
+
+    // Return true if the operation has completed, never blocks.
+    bool is_ready();
+
+    // Wait for the operation to complete and return its result, this can
+    // only be called once.
+    bool get();
+
+private:
+    details::async_operation * op_;
+};
+
+} // namespace soci
+
+#endif // SOCI_ASYNC_RESULT_H_INCLUDED
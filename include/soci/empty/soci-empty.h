@@ -20,6 +20,7 @@
 
 #include <cstddef>
 #include <string>
+#include <vector>
 
 namespace soci
 {
@@ -29,7 +30,7 @@ struct empty_statement_backend;
 struct SOCI_EMPTY_DECL empty_standard_into_type_backend : details::standard_into_type_backend
 {
     empty_standard_into_type_backend(empty_statement_backend &st)
-        : statement_(st)
+        : statement_(st), data_(NULL), type_(), position_(0)
     {}
 
     void define_by_pos(int& position, void* data, details::exchange_type type) SOCI_OVERRIDE;
@@ -40,12 +41,16 @@ struct SOCI_EMPTY_DECL empty_standard_into_type_backend : details::standard_into
     void clean_up() SOCI_OVERRIDE;
 
     empty_statement_backend& statement_;
+
+    void* data_;
+    details::exchange_type type_;
+    int position_;
 };
 
 struct SOCI_EMPTY_DECL empty_vector_into_type_backend : details::vector_into_type_backend
 {
     empty_vector_into_type_backend(empty_statement_backend &st)
-        : statement_(st)
+        : statement_(st), data_(NULL), type_(), position_(0)
     {}
 
     void define_by_pos(int& position, void* data, details::exchange_type type) SOCI_OVERRIDE;
@@ -59,6 +64,10 @@ struct SOCI_EMPTY_DECL empty_vector_into_type_backend : details::vector_into_typ
     void clean_up() SOCI_OVERRIDE;
 
     empty_statement_backend& statement_;
+
+    void* data_;
+    details::exchange_type type_;
+    int position_;
 };
 
 struct SOCI_EMPTY_DECL empty_standard_use_type_backend : details::standard_use_type_backend
@@ -81,7 +90,7 @@ struct SOCI_EMPTY_DECL empty_standard_use_type_backend : details::standard_use_t
 struct SOCI_EMPTY_DECL empty_vector_use_type_backend : details::vector_use_type_backend
 {
     empty_vector_use_type_backend(empty_statement_backend &st)
-        : statement_(st) {}
+        : statement_(st), data_(NULL), type_() {}
 
     void bind_by_pos(int& position, void* data, details::exchange_type type) SOCI_OVERRIDE;
     void bind_by_name(std::string const& name, void* data, details::exchange_type type) SOCI_OVERRIDE;
@@ -93,6 +102,27 @@ struct SOCI_EMPTY_DECL empty_vector_use_type_backend : details::vector_use_type_
     void clean_up() SOCI_OVERRIDE;
 
     empty_statement_backend& statement_;
+
+    void* data_;
+    details::exchange_type type_;
+};
+
+// Description of the synthetic result set returned by all the queries
+// executed using this backend, which allows to use it as a mock database for
+// testing and benchmarking SOCI core without any database overhead.
+//
+// The value of a column in the row N is N for integer columns, N + 0.5 for
+// floating point ones, a fixed string of stringSize characters for string
+// ones and a fixed date for dates. The into elements for the positions beyond
+// the last column (by default there are no columns at all) are never written
+// to and so keep their values.
+struct empty_result_set
+{
+    empty_result_set() : rows(1), stringSize(8) {}
+
+    std::size_t rows;
+    std::vector<data_type> columns;
+    std::size_t stringSize;
 };
 
 struct empty_session_backend;
@@ -121,7 +151,24 @@ struct SOCI_EMPTY_DECL empty_statement_backend : details::statement_backend
     empty_vector_into_type_backend* make_vector_into_type_backend() SOCI_OVERRIDE;
     empty_vector_use_type_backend* make_vector_use_type_backend() SOCI_OVERRIDE;
 
+    // Store the value of the column at the given (1-based) position in the
+    // given row of the result set into the object of the given type.
+    void get_value(std::size_t row, int position,
+        void* data, details::exchange_type type) const;
+
     empty_session_backend& session_;
+
+    // Number of into elements defined for this statement: if there are none,
+    // the statement is assumed to be a DML one.
+    int intosCount_;
+
+    // Index of the first row fetched by the last execute() or fetch() call,
+    // the number of rows fetched by it and the index of the next row.
+    std::size_t firstRow_;
+    std::size_t rowsFetched_;
+    std::size_t nextRow_;
+
+    long long affectedRows_;
 };
 
 struct empty_rowid_backend : details::rowid_backend
@@ -146,8 +193,13 @@ struct empty_blob_backend : details::blob_backend
     empty_session_backend& session_;
 };
 
-struct empty_session_backend : details::session_backend
+struct SOCI_EMPTY_DECL empty_session_backend : details::session_backend
 {
+    // The connect string may contain "rows=N", "columns=type1,type2,..."
+    // (where the types are "string", "date", "double", "integer", "long_long"
+    // or "unsigned_long_long") and "string_size=N" options defining the
+    // result set, see empty_result_set. Words without "=" are ignored, but
+    // unknown options result in an exception.
     empty_session_backend(connection_parameters const& parameters);
 
     ~empty_session_backend() SOCI_OVERRIDE;
@@ -167,6 +219,18 @@ struct empty_session_backend : details::session_backend
     empty_statement_backend* make_statement_backend() SOCI_OVERRIDE;
     empty_rowid_backend* make_rowid_backend() SOCI_OVERRIDE;
     empty_blob_backend* make_blob_backend() SOCI_OVERRIDE;
+
+    // Change the result set returned by the statements executed after this
+    // call.
+    void set_result_set(empty_result_set const& resultSet);
+    empty_result_set const& get_result_set() const { return resultSet_; }
+
+    // The value used for all string columns.
+    std::string const& get_string_value() const { return stringValue_; }
+
+private:
+    empty_result_set resultSet_;
+    std::string stringValue_;
 };
 
 struct SOCI_EMPTY_DECL empty_backend_factory : backend_factory
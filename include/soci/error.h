@@ -50,7 +50,8 @@ public:
         constraint_violation,
         unknown_transaction_state,
         system_error,
-        unknown
+        unknown,
+        query_cancelled
     };
 
     // Basic error classification support
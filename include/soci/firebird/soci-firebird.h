@@ -236,6 +236,26 @@ protected:
     virtual void rewriteParameters(std::string const & src,
         std::vector<char> & dst);
 
+    // Copy the values of all vector use elements at the given row into the
+    // input parameters buffers.
+    void exchangeUseData(std::size_t row);
+
+    // Return the number of rows affected by the last execution of stmtp_.
+    long long getRowCount();
+
+    // Execute the statement with vector use elements using IBatch interface,
+    // if supported by both the client library and the server, return false
+    // if it can't be used.
+    bool executeBatch(std::size_t rows);
+
+    // Execute the statement with vector use elements by combining several
+    // rows into EXECUTE BLOCK statements, if possible, or executing the rows
+    // one by one otherwise.
+    void executeBlocks(std::size_t rows);
+
+    // Execute the statement for the current values of the parameters.
+    void executeRow();
+
     BuffersType intoType_;
     BuffersType useType_;
 
@@ -247,6 +267,14 @@ protected:
     std::map <std::string, int> names_;
 
     bool procedure_;
+
+    // The type of the statement, as returned by isc_info_sql_stmt_type, and
+    // the query passed to the server, used for executing it in batches.
+    int stmtType_;
+    std::string query_;
+
+    // Set to false if the server doesn't support batches.
+    bool batchSupported_;
 };
 
 struct firebird_blob_backend : details::blob_backend
@@ -43,6 +43,10 @@ public:
 
     virtual std::size_t size() const = 0;  // returns the number of elements
     virtual void resize(std::size_t /* sz */) {} // used for vectors only
+
+    // returns the approximate size of the data currently stored in the
+    // element, used for statistics only
+    virtual std::size_t data_size() const { return 0; }
 };
 
 typedef type_ptr<into_type_base> into_type_ptr;
@@ -75,6 +79,7 @@ private:
     void clean_up() SOCI_OVERRIDE;
 
     std::size_t size() const SOCI_OVERRIDE { return 1; }
+    std::size_t data_size() const SOCI_OVERRIDE;
 
     // conversion hook (from base type to arbitrary user type)
     virtual void convert_from_base() {}
@@ -121,6 +126,7 @@ protected:
     void clean_up() SOCI_OVERRIDE;
     void resize(std::size_t sz) SOCI_OVERRIDE;
     std::size_t size() const SOCI_OVERRIDE;
+    std::size_t data_size() const SOCI_OVERRIDE;
 
     void * data_;
     exchange_type type_;
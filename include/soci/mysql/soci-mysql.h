@@ -18,6 +18,7 @@
 #endif
 
 #include <soci/soci-backend.h>
+#include <soci/exchange-traits.h>
 #ifdef _WIN32
 #include <winsock.h> // SOCKET
 #endif // _WIN32
@@ -45,6 +46,11 @@ public:
                errNum == 1927) { // Lost connection to backend server
                 cat_ = connection_error;
             }
+            else if (errNum == 1317 || // Query execution was interrupted
+                     errNum == 3024 || // Maximum statement execution time exceeded
+                     errNum == 1969) { // Same as above but in MariaDB
+                cat_ = query_cancelled;
+            }
         }
 
     error_category get_error_category() const SOCI_OVERRIDE { return cat_; }
@@ -53,6 +59,28 @@ public:
     error_category cat_;
 };
 
+// The ways of retrieving the results of the statements with vector into
+// elements from the server.
+enum mysql_result_mode
+{
+    // Use a read-only server-side cursor, fetching the rows in batches of the
+    // vector size: this keeps the memory use low on both sides, but the
+    // server may need to materialize the result in a temporary table and
+    // each batch requires a round trip.
+    mysql_result_cursor,
+
+    // Read the entire result into the client memory when executing the
+    // statement using mysql_stmt_store_result(): this is usually the fastest
+    // mode for small and medium results.
+    mysql_result_buffered,
+
+    // Read the rows from the connection as they are fetched: this avoids
+    // both the server temporary tables and storing the result on the client,
+    // but no other statements can be executed using the same session until
+    // all the rows are fetched.
+    mysql_result_unbuffered
+};
+
 struct mysql_statement_backend;
 struct mysql_standard_into_type_backend : details::standard_into_type_backend
 {
@@ -68,6 +96,16 @@ struct mysql_standard_into_type_backend : details::standard_into_type_backend
 
     void clean_up() SOCI_OVERRIDE;
 
+    // Allocate the buffer for the string value and bind it.
+    void bind_string_buffer();
+
+    // Bind the given buffer to the result column.
+    void bind_result(void* data, unsigned long size);
+
+    // Store the value of the current row when the statement is executed
+    // using the text protocol.
+    void post_fetch_text(indicator *ind);
+
     mysql_statement_backend &statement_;
 
     char* buf_;        // generic buffer
@@ -85,7 +123,7 @@ struct mysql_vector_into_type_backend : details::vector_into_type_backend
 {
     mysql_vector_into_type_backend(mysql_statement_backend &st)
         : statement_(st), data_(NULL), position_(0), colSize_(0), buf_(NULL), isNull_(false),
-        isError_(false), length_(0)
+        isError_(false), length_(0), store_(NULL)
     {}
 
     void define_by_pos(int &position,
@@ -100,11 +138,10 @@ struct mysql_vector_into_type_backend : details::vector_into_type_backend
     void clean_up() SOCI_OVERRIDE;
 
     // Normally data retrieved from the database is handled in post_fetch(),
-    // however we may need to call mysql_fetch    // Normally data retrieved from the database is handled in post_fetch(),
-    // however we may need to call SQLFetch() multiple times, so we call this
-    // function instead after each call to it to retrieve the given range of
-    // rows.
-    void do_post_fetch_row(std::size_t beginRow); 
+    // however we need to call mysql_stmt_fetch() for each row, so we call
+    // this function instead after each call to it to store the value of the
+    // row with the given index.
+    void do_post_fetch_row(std::size_t rowNum);
 
     mysql_statement_backend &statement_;
     void *data_;
@@ -119,12 +156,17 @@ struct mysql_vector_into_type_backend : details::vector_into_type_backend
     my_bool isError_;
     unsigned long length_;
 
+    // Function storing the value fetched into buf_ in the vector element
+    // with the given index, selected once by define_by_pos() depending on
+    // type_ to avoid checking the type for every row.
+    typedef void (*store_type)(mysql_vector_into_type_backend &, std::size_t);
+    store_type store_;
 };
 
 struct mysql_standard_use_type_backend : details::standard_use_type_backend
 {
     mysql_standard_use_type_backend(mysql_statement_backend &st)
-        : statement_(st), position_(0), buf_(NULL), size_(0), isnull_(false), indHolder_(STMT_INDICATOR_NONE){}
+        : statement_(st), position_(0), size_(0), isnull_(false), indHolder_(STMT_INDICATOR_NONE){}
 
     void bind_by_pos(int &position,
         void *data, details::exchange_type type, bool readOnly) SOCI_OVERRIDE;
@@ -145,15 +187,17 @@ struct mysql_standard_use_type_backend : details::standard_use_type_backend
     details::exchange_type type_;
     int position_;
     std::string name_;
-    char *buf_;
     unsigned long size_;
-    bool isnull_;
+    my_bool isnull_;
     enum_indicator_type indHolder_;
 
+    // The value of x_stdtm element converted to MySQL representation.
+    MYSQL_TIME time_;
+
 private:
-    // Copy string data to buf_ and set size, sqlType and cType to the values
-    // appropriate for strings.
-    void copy_from_string(std::string const& s,
+    // Return the pointer to the string data and set size and sqlType to the
+    // values appropriate for strings.
+    void* bind_string(std::string const& s,
         unsigned long& size,
         enum_field_types& sqlType);
 };
@@ -161,7 +205,7 @@ private:
 struct mysql_vector_use_type_backend : details::vector_use_type_backend
 {
     mysql_vector_use_type_backend(mysql_statement_backend &st)
-        : statement_(st), position_(0), buf_(NULL), colSize_(0){}
+        : statement_(st), position_(0), colSize_(0){}
 
     void bind_by_pos(int &position,
         void *data, details::exchange_type type) SOCI_OVERRIDE;
@@ -183,7 +227,12 @@ struct mysql_vector_use_type_backend : details::vector_use_type_backend
     std::vector<char *> buffers_;
     std::vector<char> indHolderVec_;
     std::vector<unsigned long> lengths_;
-    char* buf_;
+
+    // Pointers to the values for the types which are not bound directly,
+    // reused by all executions of the statement, so that the binding only
+    // changes if the vector size does.
+    std::vector<void*> pointers_;
+
     int colSize_;
     MYSQL_BIND bindingInfo_;
 
@@ -217,23 +266,45 @@ struct mysql_statement_backend : details::statement_backend
     void describe_column(int colNum, data_type &dtype,
         std::string &columnName) SOCI_OVERRIDE;
 
+    void set_timeout(int milliseconds) SOCI_OVERRIDE;
+
     // helper for defining into vector<string>
     std::size_t column_size(int position);
+
+    // Prepare the statement on the server, if it hasn't been done yet.
+    void ensure_prepared();
+
+    // Return true if the statement will be executed using the text protocol,
+    // i.e. using mysql_real_query() instead of preparing it first, which is
+    // done for the one-time queries without any parameters and vector intos
+    // to avoid unnecessary round trips to the server.
+    bool use_text_protocol() const;
     mysql_standard_into_type_backend * make_into_type_backend() SOCI_OVERRIDE;
     mysql_standard_use_type_backend * make_use_type_backend() SOCI_OVERRIDE;
     mysql_vector_into_type_backend * make_vector_into_type_backend() SOCI_OVERRIDE;
     mysql_vector_use_type_backend * make_vector_use_type_backend() SOCI_OVERRIDE;
 
-    void addParameterBinding(MYSQL_BIND* bindingInfo)
+    // Set the binding of the parameter or result column at the given
+    // 1-based position. The bindings are only passed to MySQL again when
+    // executing the statement if they changed since the last time.
+    void setParameterBinding(int position, MYSQL_BIND const& bindingInfo)
     {
-        parameterBindingList_.push_back(bindingInfo);
+        setBinding(parameterBindings_, position, bindingInfo,
+                   parameterBindingsChanged_);
     }
 
-    void addResultBinding(MYSQL_BIND* bindingInfo)
+    void setResultBinding(int position, MYSQL_BIND const& bindingInfo)
     {
-        resultBindingList_.push_back(bindingInfo);
+        setBinding(resultBindings_, position, bindingInfo,
+                   resultBindingsChanged_);
     }
 
+    // Change the result mode used by this statement, by default the mode of
+    // the session is used. Takes effect the next time the statement is
+    // executed.
+    void set_result_mode(mysql_result_mode mode) { resultMode_ = mode; }
+    mysql_result_mode get_result_mode() const { return resultMode_; }
+
 
     mysql_session_backend &session_;
     MYSQL_STMT* hstmt_;
@@ -273,6 +344,19 @@ struct mysql_statement_backend : details::statement_backend
     std::string query_;
     MYSQL_RES* metadata_;
 
+    // True for st_one_time_query statements, which are only prepared when
+    // necessary, and true if the statement has been prepared.
+    bool oneTimeQuery_;
+    bool prepared_;
+
+    // The query as specified by the user, used with the text protocol.
+    std::string originalQuery_;
+
+    // The current row of result_ and the lengths of its values when using
+    // the text protocol, or NULL.
+    MYSQL_ROW textRow_;
+    unsigned long* textLengths_;
+
     // the following maps are used for finding data buffers according to
     // use elements specified by the user
 
@@ -287,10 +371,31 @@ struct mysql_statement_backend : details::statement_backend
     // we're not using any vector "intos".
     std::vector<mysql_vector_into_type_backend*> intos_;
 
-    std::vector<MYSQL_BIND*> parameterBindingList_;
-    std::vector<MYSQL_BIND*> resultBindingList_;
+    // Contiguous arrays of bindings passed to mysql_stmt_bind_param() and
+    // mysql_stmt_bind_result() and the flags indicating whether they need to
+    // be passed to MySQL again.
+    std::vector<MYSQL_BIND> parameterBindings_;
+    std::vector<MYSQL_BIND> resultBindings_;
+    bool parameterBindingsChanged_;
+    bool resultBindingsChanged_;
+
+    // The array size used when the parameters were last bound.
+    int boundArraySize_;
+
+    mysql_result_mode resultMode_;
+
+    // Maximal execution time in milliseconds, 0 if not limited.
+    int timeout_;
 
 private:
+    // execute() and fetch() implementations for the text protocol.
+    exec_fetch_result execute_text(int number);
+    exec_fetch_result fetch_text();
+    void free_text_result();
+
+    static void setBinding(std::vector<MYSQL_BIND>& bindings, int position,
+        MYSQL_BIND const& bindingInfo, bool& changed);
+
     // fetch() helper wrapping mysql_stmt_fetch() call for the given range of rows.
     exec_fetch_result do_fetch(int rowNum);
 };
@@ -327,12 +432,24 @@ struct mysql_session_backend : details::session_backend
 
     bool is_connected() SOCI_OVERRIDE;
 
+    // Uses a separate connection to execute "KILL QUERY" for this one.
+    void cancel() SOCI_OVERRIDE;
+
     void begin() SOCI_OVERRIDE;
     void commit() SOCI_OVERRIDE;
     void rollback() SOCI_OVERRIDE;
 
     bool get_last_insert_id(session&, std::string const&, long long&) SOCI_OVERRIDE;
 
+    // Change the maximal execution time of the statements for the
+    // connection, if necessary. Notice that MySQL only limits the execution
+    // time of SELECT statements, while MariaDB limits all of them.
+    void set_statement_timeout(int milliseconds);
+
+    // Update the server thread id used by cancel(), which changes if the
+    // connection was silently re-established due to "reconnect" option.
+    void update_thread_id();
+
     // Note that MySQL supports both "SELECT 2+2" and "SELECT 2+2 FROM DUAL"
     // syntaxes, but there doesn't seem to be any reason to use the longer one.
     std::string get_dummy_from_table() const SOCI_OVERRIDE { return std::string(); }
@@ -345,7 +462,25 @@ struct mysql_session_backend : details::session_backend
     mysql_rowid_backend * make_rowid_backend() SOCI_OVERRIDE;
     mysql_blob_backend * make_blob_backend() SOCI_OVERRIDE;
 
+    // The result mode used by the statements created after calling this
+    // function, mysql_result_cursor by default and can also be set using
+    // "result_mode" connection option.
+    void set_result_mode(mysql_result_mode mode) { resultMode_ = mode; }
+    mysql_result_mode get_result_mode() const { return resultMode_; }
+
     MYSQL *conn_;
+    mysql_result_mode resultMode_;
+
+    // Used for opening the connection used by cancel().
+    std::string connectString_;
+
+    // Id of the server thread used by conn_, needed for cancelling queries.
+    // It is only accessed atomically, as cancel() is called from other
+    // threads.
+    unsigned long threadId_;
+
+    // Current statement timeout in milliseconds, 0 if not set.
+    int statementTimeout_;
 };
 
 
@@ -358,6 +493,82 @@ struct mysql_backend_factory : backend_factory
 
 extern SOCI_MYSQL_DECL mysql_backend_factory const mysql;
 
+// Loads rows into a table using "LOAD DATA LOCAL INFILE" statement, which is
+// much faster than inserting them, even using vector use elements, when
+// loading many rows. The rows are streamed directly from the vectors, without
+// using any temporary files.
+//
+// The session must be opened with "local_infile=1" option to use this class.
+//
+// Example:
+//
+//     mysql_bulk_loader loader(sql, "persons");
+//     loader.add("id", ids);
+//     loader.add("name", names, nameIndicators);
+//     long long const rows = loader.load();
+class SOCI_MYSQL_DECL mysql_bulk_loader
+{
+public:
+    // The table and column names are quoted by this class and must not be
+    // quoted by the caller. The table name may be qualified with the database
+    // name, using a dot as separator.
+    mysql_bulk_loader(session & sql, std::string const & table);
+
+    // Add a column with the values to load into it, all vectors must have the
+    // same size. The vectors are only used by load() and must remain alive
+    // until it is called.
+    template <typename T>
+    void add(std::string const & column, std::vector<T> const & data)
+    {
+        add_column(column, const_cast<std::vector<T> *>(&data),
+            static_cast<details::exchange_type>(
+                details::exchange_traits<T>::x_type),
+            NULL);
+    }
+
+    // Add a column with the indicators: the values with i_null indicator are
+    // loaded as NULL.
+    template <typename T>
+    void add(std::string const & column, std::vector<T> const & data,
+        std::vector<indicator> const & ind)
+    {
+        add_column(column, const_cast<std::vector<T> *>(&data),
+            static_cast<details::exchange_type>(
+                details::exchange_traits<T>::x_type),
+            &ind);
+    }
+
+    // Load all the rows and return the number of rows affected, as returned
+    // by statement::get_affected_rows() when using vector use elements.
+    //
+    // Note that MySQL reports the data conversion problems and duplicate keys
+    // only as warnings when using "LOCAL" loads, check get_warning_count() to
+    // detect them.
+    long long load();
+
+    // Return the number of warnings generated by the last call to load().
+    unsigned int get_warning_count() const { return warnings_; }
+
+    struct column_info
+    {
+        std::string name_;
+        void * data_;
+        details::exchange_type type_;
+        std::vector<indicator> const * ind_;
+    };
+
+private:
+    void add_column(std::string const & column, void * data,
+        details::exchange_type type, std::vector<indicator> const * ind);
+
+    MYSQL * const conn_;
+    std::string const table_;
+    std::vector<column_info> columns_;
+    unsigned int warnings_;
+
+    SOCI_NOT_COPYABLE(mysql_bulk_loader)
+};
+
 extern "C"
 {
 
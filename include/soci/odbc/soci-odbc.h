@@ -37,6 +37,10 @@ namespace details
     // https://msdn.microsoft.com/en-us/library/ms130896.aspx
     SQLLEN const ODBC_MAX_COL_SIZE = 8000;
 
+    // Size of the buffer used for retrieving the values of long columns, not
+    // bound to any buffer, in chunks using SQLGetData().
+    std::size_t const odbc_get_data_chunk_size = 64 * 1024;
+
     // This cast is only used to avoid compiler warnings when passing strings
     // to ODBC functions, the returned string may *not* be really modified.
     inline SQLCHAR* sqlchar_cast(std::string const& s)
@@ -115,7 +119,7 @@ struct odbc_vector_into_type_backend : details::vector_into_type_backend,
 {
     odbc_vector_into_type_backend(odbc_statement_backend &st)
         : odbc_standard_type_backend_base(st),
-          data_(NULL), buf_(NULL), position_(0) {}
+          data_(NULL), buf_(NULL), position_(0), longColumn_(false) {}
 
     void define_by_pos(int &position,
         void *data, details::exchange_type type) SOCI_OVERRIDE;
@@ -137,11 +141,21 @@ struct odbc_vector_into_type_backend : details::vector_into_type_backend,
     // IBM DB2 driver is not compliant to ODBC spec for indicators in 64bit
     // SQLLEN is still defined 32bit (int) but spec requires 64bit (long)
     inline SQLLEN get_sqllen_from_vector_at(std::size_t idx) const;
+    inline void set_sqllen_from_vector_at(std::size_t idx, SQLLEN val);
 
     // Rebind the single vector value at the given index to the first row.
     // Used when vector values are fetched by single row.
     void rebind_row(std::size_t rowInd);
 
+    // Replace the chunk buffer of a long column with a buffer big enough for
+    // the entire value, used if its values can't be retrieved using
+    // SQLGetData() and so it must be bound, as all the other columns.
+    void bind_long_column();
+
+    // Retrieve the value of a long column at the current cursor position
+    // using SQLGetData() and store it at the given index.
+    void get_long_column_data(std::size_t rowInd);
+
     std::vector<SQLLEN> indHolderVec_;
     void *data_;
     char *buf_;              // generic buffer
@@ -149,6 +163,9 @@ struct odbc_vector_into_type_backend : details::vector_into_type_backend,
     std::size_t colSize_;    // size of the string column (used for strings)
     SQLSMALLINT odbcType_;
     int position_;
+
+    // True for string columns too big to allocate a buffer for all rows.
+    bool longColumn_;
 };
 
 struct odbc_standard_use_type_backend : details::standard_use_type_backend,
@@ -254,6 +271,9 @@ struct odbc_statement_backend : details::statement_backend
     void describe_column(int colNum, data_type &dtype,
         std::string &columnName) SOCI_OVERRIDE;
 
+    // ODBC query timeout is in seconds, so the value is rounded up.
+    void set_timeout(int milliseconds) SOCI_OVERRIDE;
+
     // helper for defining into vector<string>
     std::size_t column_size(int position);
 
@@ -262,16 +282,29 @@ struct odbc_statement_backend : details::statement_backend
     odbc_vector_into_type_backend * make_vector_into_type_backend() SOCI_OVERRIDE;
     odbc_vector_use_type_backend * make_vector_use_type_backend() SOCI_OVERRIDE;
 
+    // The ways of fetching the long vector into columns, see
+    // odbc_vector_into_type_backend::longColumn_.
+    enum long_columns_mode
+    {
+        long_columns_none,      // There are no long columns.
+        long_columns_pending,   // Mode will be chosen on the next fetch.
+        long_columns_get_data,  // Left unbound, retrieved with SQLGetData().
+        long_columns_bound      // Bound to huge buffers, fetched by rows.
+    };
+
     odbc_session_backend &session_;
     SQLHSTMT hstmt_;
     SQLULEN numRowsFetched_;
     bool fetchVectorByRows_;
+    long_columns_mode longColumnsMode_;
     bool hasVectorUseElements_;
     bool boundByName_;
     bool boundByPos_;
 
     long long rowsAffected_; // number of rows affected by the last operation
 
+    int timeout_; // query timeout in milliseconds, 0 if none
+
     std::string query_;
     std::vector<std::string> names_; // list of names for named binds
 
@@ -280,8 +313,17 @@ struct odbc_statement_backend : details::statement_backend
     std::vector<odbc_vector_into_type_backend*> intos_;
 
 private:
+    // Set SQL_ATTR_QUERY_TIMEOUT statement attribute to timeout_ value.
+    void apply_timeout();
+
     // fetch() helper wrapping SQLFetch() call for the given range of rows.
     exec_fetch_result do_fetch(int beginRow, int endRow);
+
+    // fetch() helper choosing the value of longColumnsMode_.
+    void choose_long_columns_mode();
+
+    // Retrieve the values of all long columns at the current cursor position.
+    void get_long_columns_data(std::size_t rowInd);
 };
 
 struct odbc_rowid_backend : details::rowid_backend
@@ -316,10 +358,17 @@ struct odbc_session_backend : details::session_backend
 
     bool is_connected() SOCI_OVERRIDE;
 
+    // Cancels the statement currently executed or fetched using SQLCancel().
+    void cancel() SOCI_OVERRIDE;
+
     void begin() SOCI_OVERRIDE;
     void commit() SOCI_OVERRIDE;
     void rollback() SOCI_OVERRIDE;
 
+    // Set the statement which is currently being executed or fetched, used
+    // by cancel(), and return the previous one. The statement can be null.
+    SQLHSTMT set_active_statement(SQLHSTMT hstmt);
+
     bool get_next_sequence_value(session & s,
         std::string const & sequence, long long & value) SOCI_OVERRIDE;
     bool get_last_insert_id(session & s,
@@ -354,6 +403,10 @@ struct odbc_session_backend : details::session_backend
     // Determine the type of the database we're connected to.
     SOCI_ODBC_DECL database_product get_database_product() const;
 
+    // Return the SQL_GD_XXX bit mask of SQLGetData() extensions supported by
+    // the driver.
+    SQLUINTEGER get_data_extensions() const;
+
     // Return full ODBC connection string.
     std::string get_connection_string() const { return connection_string_; }
 
@@ -364,6 +417,13 @@ struct odbc_session_backend : details::session_backend
 
 private:
     mutable database_product product_;
+
+    mutable SQLUINTEGER dataExtensions_;
+    mutable bool dataExtensionsInitialized_;
+
+    // The statement used by cancel() and the mutex protecting it.
+    struct active_statement;
+    active_statement * activeStatement_;
 };
 
 class SOCI_ODBC_DECL odbc_soci_error : public soci_error
@@ -396,6 +456,10 @@ public:
         if (strcmp(s, "HY014") == 0)
             return system_error;
 
+        if (strcmp(s, "HY008") == 0 ||
+            strcmp(s, "HYT00") == 0)
+            return query_cancelled;
+
         return unknown;
     }
 
@@ -556,6 +620,18 @@ inline SQLLEN odbc_vector_into_type_backend::get_sqllen_from_vector_at(std::size
     return indHolderVec_[idx];
 }
 
+inline void odbc_vector_into_type_backend::set_sqllen_from_vector_at(std::size_t idx, SQLLEN val)
+{
+    if (requires_noncompliant_32bit_sqllen())
+    {
+        reinterpret_cast<int*>(&indHolderVec_[0])[idx] = static_cast<int>(val);
+    }
+    else
+    {
+        indHolderVec_[idx] = val;
+    }
+}
+
 inline void odbc_vector_use_type_backend::set_sqllen_from_vector_at(const std::size_t idx, const SQLLEN val)
 {
     if (requires_noncompliant_32bit_sqllen())
@@ -580,6 +656,227 @@ inline void odbc_vector_use_type_backend::set_sqllen_from_vector_at(const std::s
     }
 }
 
+class statement;
+
+// Specialize this trait for a struct with a fixed layout, i.e. containing only
+// scalar members and fixed size char arrays, to allow fetching it using
+// odbc_row_fetcher. The specialization must define a static describe()
+// function adding its members corresponding to the selected columns in the
+// order of the select list, optionally with the members used as indicators:
+//
+//     struct person
+//     {
+//         int id;
+//         char name[64];
+//         SQLLEN nameInd; // Only needed if the column can be NULL.
+//     };
+//
+//     namespace soci
+//     {
+//     template <>
+//     struct odbc_row_traits<person>
+//     {
+//         static void describe(odbc_row_description<person> & d)
+//         {
+//             d.add(&person::id);
+//             d.add(&person::name, &person::nameInd);
+//         }
+//     };
+//     }
+template <typename T>
+struct odbc_row_traits;
+
+namespace details
+{
+
+// ODBC C types corresponding to the supported struct member types.
+template <typename M>
+struct odbc_row_member_type;
+
+template <>
+struct odbc_row_member_type<short>
+{
+    static SQLSMALLINT const c_type = SQL_C_SSHORT;
+};
+
+template <>
+struct odbc_row_member_type<int>
+{
+    static SQLSMALLINT const c_type = SQL_C_SLONG;
+};
+
+template <>
+struct odbc_row_member_type<long long>
+{
+    static SQLSMALLINT const c_type = SQL_C_SBIGINT;
+};
+
+template <>
+struct odbc_row_member_type<unsigned long long>
+{
+    static SQLSMALLINT const c_type = SQL_C_UBIGINT;
+};
+
+template <>
+struct odbc_row_member_type<double>
+{
+    static SQLSMALLINT const c_type = SQL_C_DOUBLE;
+};
+
+template <>
+struct odbc_row_member_type<TIMESTAMP_STRUCT>
+{
+    static SQLSMALLINT const c_type = SQL_C_TYPE_TIMESTAMP;
+};
+
+} // namespace details
+
+template <typename T>
+class odbc_row_description;
+
+// Non-template part of odbc_row_fetcher.
+class SOCI_ODBC_DECL odbc_row_fetcher_base
+{
+protected:
+    odbc_row_fetcher_base(statement & st, std::size_t rowSize);
+
+    // Not virtual as this class is not meant to be used polymorphically.
+    ~odbc_row_fetcher_base();
+
+    // Fetch at most count rows into the given array and return the number of
+    // rows actually fetched.
+    std::size_t do_fetch(void * rows, std::size_t count);
+
+private:
+    template <typename T>
+    friend class odbc_row_description;
+
+    void add_column(SQLSMALLINT cType, std::size_t offset, SQLLEN size,
+        bool hasInd, std::size_t indOffset);
+
+    struct column_info
+    {
+        SQLSMALLINT cType_;
+        std::size_t offset_;
+        SQLLEN size_;
+        bool hasInd_;
+        std::size_t indOffset_;
+    };
+
+    odbc_statement_backend & statement_;
+    std::size_t const rowSize_;
+    std::vector<column_info> columns_;
+
+    // The array to which the columns are currently bound, if any.
+    void * boundRows_;
+
+    SQLULEN numRowsFetched_;
+
+    SOCI_NOT_COPYABLE(odbc_row_fetcher_base)
+};
+
+// Object passed to odbc_row_traits<T>::describe().
+template <typename T>
+class odbc_row_description
+{
+public:
+    odbc_row_description(odbc_row_fetcher_base & fetcher, T const & sample)
+        : fetcher_(fetcher), sample_(sample)
+    {
+    }
+
+    template <typename M>
+    void add(M T::* member)
+    {
+        fetcher_.add_column(details::odbc_row_member_type<M>::c_type,
+            offset_of(member), sizeof(M), false, 0);
+    }
+
+    template <typename M>
+    void add(M T::* member, SQLLEN T::* ind)
+    {
+        fetcher_.add_column(details::odbc_row_member_type<M>::c_type,
+            offset_of(member), sizeof(M), true, offset_of(ind));
+    }
+
+    // Strings are stored as NUL-terminated, so at most N - 1 characters are
+    // fetched into char[N] member.
+    template <std::size_t N>
+    void add(char (T::* member)[N])
+    {
+        fetcher_.add_column(SQL_C_CHAR, offset_of(member), N, false, 0);
+    }
+
+    template <std::size_t N>
+    void add(char (T::* member)[N], SQLLEN T::* ind)
+    {
+        fetcher_.add_column(SQL_C_CHAR, offset_of(member), N,
+            true, offset_of(ind));
+    }
+
+private:
+    template <typename M>
+    std::size_t offset_of(M T::* member) const
+    {
+        return static_cast<std::size_t>(
+            reinterpret_cast<char const *>(&(sample_.*member)) -
+            reinterpret_cast<char const *>(&sample_));
+    }
+
+    odbc_row_fetcher_base & fetcher_;
+    T const & sample_;
+
+    SOCI_NOT_COPYABLE(odbc_row_description)
+};
+
+// Fetches the rows of a statement using row-wise binding, i.e. with the
+// driver storing the values of all columns of each row directly into the
+// elements of a vector of structs described by odbc_row_traits<T>. This is
+// faster than using separate vector into elements for all the columns.
+//
+// The statement must have been executed without any into elements and must
+// remain alive while this object exists. NULL values can be fetched only into
+// the members having indicators, which are set to SQL_NULL_DATA for them.
+//
+// Example:
+//
+//     statement st = (sql.prepare << "select id, name from person");
+//     st.execute();
+//
+//     std::vector<person> persons(100);
+//     odbc_row_fetcher<person> fetcher(st);
+//     while (fetcher.fetch(persons))
+//     {
+//         ... use persons ...
+//     }
+template <typename T>
+class odbc_row_fetcher : public odbc_row_fetcher_base
+{
+public:
+    explicit odbc_row_fetcher(statement & st)
+        : odbc_row_fetcher_base(st, sizeof(T))
+    {
+        T const sample = T();
+        odbc_row_description<T> description(*this, sample);
+        odbc_row_traits<T>::describe(description);
+    }
+
+    // Fetch at most rows.size() rows into the given vector, resizing it to
+    // the number of rows actually fetched. Return false if there are no more
+    // rows.
+    bool fetch(std::vector<T> & rows)
+    {
+        if (rows.empty())
+        {
+            throw soci_error("Vectors of size 0 are not allowed.");
+        }
+
+        rows.resize(do_fetch(&rows[0], rows.size()));
+
+        return !rows.empty();
+    }
+};
+
 struct odbc_backend_factory : backend_factory
 {
     odbc_backend_factory() {}
@@ -262,6 +262,10 @@ struct postgresql_statement_backend : details::statement_backend
     exec_fetch_result execute(int number) SOCI_OVERRIDE;
     exec_fetch_result fetch(int number) SOCI_OVERRIDE;
 
+    bool send_execute(int number) SOCI_OVERRIDE;
+    bool send_fetch(int number) SOCI_OVERRIDE;
+    bool is_result_ready() SOCI_OVERRIDE;
+
     long long get_affected_rows() SOCI_OVERRIDE;
     int get_number_of_rows() SOCI_OVERRIDE;
     std::string get_parameter_name(int index) const SOCI_OVERRIDE;
@@ -272,11 +276,18 @@ struct postgresql_statement_backend : details::statement_backend
     void describe_column(int colNum, data_type & dtype,
         std::string & columnName) SOCI_OVERRIDE;
 
+    void set_timeout(int milliseconds) SOCI_OVERRIDE;
+
     postgresql_standard_into_type_backend * make_into_type_backend() SOCI_OVERRIDE;
     postgresql_standard_use_type_backend * make_use_type_backend() SOCI_OVERRIDE;
     postgresql_vector_into_type_backend * make_vector_into_type_backend() SOCI_OVERRIDE;
     postgresql_vector_use_type_backend * make_vector_use_type_backend() SOCI_OVERRIDE;
 
+    // Send the query to the server, without waiting for the result if async
+    // is true. Returns false if this was a bulk operation which was already
+    // executed completely.
+    bool send_query(int number, bool async);
+
     postgresql_session_backend & session_;
 
     bool single_row_mode_;
@@ -296,11 +307,16 @@ struct postgresql_statement_backend : details::statement_backend
     bool justDescribed_; // to optimize row description with immediately
                          // following actual statement execution
 
+    bool asyncPending_; // true if waiting for the result of send_execute()
+                        // or send_fetch()
+
     bool hasIntoElements_;
     bool hasVectorIntoElements_;
     bool hasUseElements_;
     bool hasVectorUseElements_;
 
+    int timeout_; // statement_timeout to use in milliseconds, 0 if none
+
     // the following maps are used for finding data buffers according to
     // use elements specified by the user
 
@@ -367,12 +383,19 @@ struct postgresql_session_backend : details::session_backend
 
     bool is_connected() SOCI_OVERRIDE;
 
+    void cancel() SOCI_OVERRIDE;
+
+    int get_native_socket() SOCI_OVERRIDE { return PQsocket(conn_); }
+
     void begin() SOCI_OVERRIDE;
     void commit() SOCI_OVERRIDE;
     void rollback() SOCI_OVERRIDE;
 
     void deallocate_prepared_statement(const std::string & statementName);
 
+    // Change statement_timeout parameter for the connection, if necessary.
+    void set_statement_timeout(int milliseconds);
+
     bool get_next_sequence_value(session & s,
         std::string const & sequence, long long & value) SOCI_OVERRIDE;
 
@@ -392,6 +415,15 @@ struct postgresql_session_backend : details::session_backend
     bool single_row_mode_;
     PGconn * conn_;
     connection_parameters connectionParameters_;
+
+    // Object used for cancelling the queries executed using conn_, it's
+    // separate from it as it can be used from any thread.
+    PGcancel * cancel_;
+
+    // Current value of statement_timeout in milliseconds, 0 if it's not set
+    // or -1 if unknown, e.g. because the transaction setting it was rolled
+    // back.
+    int statementTimeout_;
 };
 
 
@@ -0,0 +1,111 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef SOCI_QUERY_STATS_H_INCLUDED
+#define SOCI_QUERY_STATS_H_INCLUDED
+
+#include "soci/soci-platform.h"
+
+// std
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace soci
+{
+
+// Aggregated statistics for all the queries sharing the same fingerprint.
+//
+// All durations are expressed in nanoseconds. Percentiles are computed from a
+// bounded random sample of the individual durations, so they are estimates
+// when the number of calls exceeds the sample size.
+struct query_stats_entry
+{
+    query_stats_entry()
+        : prepares(0), calls(0), fetches(0),
+          total_execute_ns(0), min_execute_ns(0), max_execute_ns(0),
+          p50_execute_ns(0), p99_execute_ns(0),
+          total_fetch_ns(0), min_fetch_ns(0), max_fetch_ns(0),
+          p50_fetch_ns(0), p99_fetch_ns(0),
+          rows_fetched(0), bytes_fetched(0)
+    {
+    }
+
+    // Normalized query text, see query_stats::fingerprint().
+    std::string fingerprint;
+
+    unsigned long long prepares;
+    unsigned long long calls;
+    unsigned long long fetches;
+
+    long long total_execute_ns;
+    long long min_execute_ns;
+    long long max_execute_ns;
+    long long p50_execute_ns;
+    long long p99_execute_ns;
+
+    long long total_fetch_ns;
+    long long min_fetch_ns;
+    long long max_fetch_ns;
+    long long p50_fetch_ns;
+    long long p99_fetch_ns;
+
+    unsigned long long rows_fetched;
+    unsigned long long bytes_fetched;
+};
+
+// Client-side registry of per-query statistics.
+//
+// An object of this class can be associated with one or more sessions using
+// session::set_query_stats() and then accumulates the statistics of all the
+// statements executed by them. It is thread-safe, so the same object can be
+// shared by all the sessions of a connection_pool.
+//
+// The registry is not owned by the sessions using it and must outlive them.
+class SOCI_DECL query_stats
+{
+public:
+    // The sample size determines how many individual durations are kept per
+    // fingerprint for percentile estimation.
+    explicit query_stats(std::size_t sampleSize = 1024);
+    ~query_stats();
+
+    // Functions called by the library itself to record the statistics.
+    void record_prepare(std::string const & fingerprint);
+    void record_execute(std::string const & fingerprint, long long durationNs,
+        std::size_t rows, std::size_t bytes);
+    void record_fetch(std::string const & fingerprint, long long durationNs,
+        std::size_t rows, std::size_t bytes);
+
+    // Return a consistent copy of the current statistics, sorted by the
+    // total execution time, in decreasing order.
+    std::vector<query_stats_entry> snapshot() const;
+
+    // Forget all the statistics collected so far.
+    void reset();
+
+    // Output the current statistics in human-readable or JSON form.
+    void dump_text(std::ostream & os) const;
+    void dump_json(std::ostream & os) const;
+
+    // Return the normalized form of the query: literal strings and numbers
+    // are replaced with "?", lists of literals are collapsed into a single
+    // "?", comments are removed, whitespace is collapsed and everything
+    // outside of quoted identifiers is lower-cased.
+    static std::string fingerprint(std::string const & query);
+
+private:
+    struct query_stats_impl;
+    query_stats_impl * pimpl_;
+
+    SOCI_NOT_COPYABLE(query_stats)
+};
+
+} // namespace soci
+
+#endif // SOCI_QUERY_STATS_H_INCLUDED
@@ -38,6 +38,7 @@ class blob_backend;
 
 class connection_pool;
 class failover_callback;
+class query_stats;
 
 class SOCI_DECL session
 {
@@ -67,6 +68,17 @@ public:
     // check if we have a working connection to the database
     bool is_connected() const SOCI_NOEXCEPT;
 
+    // Cancel the query currently executed using this session, if any, which
+    // then throws soci_error with query_cancelled category. Unlike all the
+    // other functions, this one can be called from another thread, but not
+    // concurrently with closing or reconnecting the session.
+    void cancel();
+
+    // Return the socket used by the connection, which becomes readable when
+    // the result of an asynchronous operation may be available, or -1 if the
+    // backend doesn't provide it. See async_result.
+    int native_socket();
+
     void begin();
     void commit();
     void rollback();
@@ -107,6 +119,13 @@ public:
     void log_query(std::string const & query);
     std::string get_last_query() const;
 
+    // Support for collecting per-query statistics.
+
+    // Set the statistics registry to use, NULL (default) disables statistics
+    // collection. The registry is not owned by the session.
+    void set_query_stats(query_stats * stats);
+    query_stats * get_query_stats() const;
+
     void set_got_data(bool gotData);
     bool got_data() const;
 
@@ -198,6 +217,8 @@ private:
 
     logger logger_;
 
+    query_stats * queryStats_;
+
     connection_parameters lastConnectParameters_;
 
     bool uppercaseColumnNames_;
@@ -200,6 +200,27 @@ public:
     virtual void describe_column(int colNum, data_type& dtype,
         std::string& column_name) = 0;
 
+    // Limit the execution time of the statement, 0 means no limit. Backends
+    // not supporting timeouts don't need to override this function.
+    virtual void set_timeout(int /* milliseconds */)
+    {
+        throw soci_error("Statement timeouts are not supported by this backend.");
+    }
+
+    // Backends able to send the statement to the server without waiting for
+    // its result should override these functions to do it and return true.
+    // In this case, is_result_ready() is called to check if the result is
+    // available and then execute() or fetch() is called with the same number
+    // to retrieve it. Otherwise, execute() or fetch() is called from another
+    // thread instead.
+    virtual bool send_execute(int /* number */) { return false; }
+    virtual bool send_fetch(int /* number */) { return false; }
+
+    // Read any data available from the server, without blocking, and return
+    // true if execute() or fetch() can now be called without blocking. In case
+    // of error, true should be returned too to let them report it.
+    virtual bool is_result_ready() { return true; }
+
     virtual standard_into_type_backend* make_into_type_backend() = 0;
     virtual standard_use_type_backend* make_use_type_backend() = 0;
     virtual vector_into_type_backend* make_vector_into_type_backend() = 0;
@@ -263,6 +284,18 @@ public:
 
     virtual bool is_connected() = 0;
 
+    // Cancel the query currently being executed, if any. This function is
+    // called from a different thread than the one executing the query, so it
+    // must be thread-safe.
+    virtual void cancel()
+    {
+        throw soci_error("Query cancellation is not supported by this backend.");
+    }
+
+    // Return the socket used for the connection to the server, or -1 if it
+    // is not available, e.g. for the embedded databases.
+    virtual int get_native_socket() { return -1; }
+
     virtual void begin() = 0;
     virtual void commit() = 0;
     virtual void rollback() = 0;
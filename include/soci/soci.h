@@ -10,6 +10,8 @@
 
 // namespace soci
 #include "soci/soci-platform.h"
+#include "soci/async-logger.h"
+#include "soci/async-result.h"
 #include "soci/backend-loader.h"
 #include "soci/blob.h"
 #include "soci/blob-exchange.h"
@@ -22,6 +24,7 @@
 #include "soci/once-temp-type.h"
 #include "soci/prepare-temp-type.h"
 #include "soci/procedure.h"
+#include "soci/query-stats.h"
 #include "soci/ref-counted-prepare-info.h"
 #include "soci/ref-counted-statement.h"
 #include "soci/row.h"
@@ -17,8 +17,12 @@
 #endif
 
 #include <cstdarg>
+#include <list>
+#include <map>
 #include <vector>
 #include <soci/soci-backend.h>
+#include <soci/connection-pool.h>
+#include <soci/into-type.h>
 
 // Disable flood of nonsense warnings generated for SQLite
 #ifdef _MSC_VER
@@ -56,6 +60,8 @@ public:
 
     int result() const;
 
+    error_category get_error_category() const SOCI_OVERRIDE;
+
 private:
     int result_;
 };
@@ -133,7 +139,8 @@ struct sqlite3_standard_use_type_backend : details::standard_use_type_backend
 struct sqlite3_vector_use_type_backend : details::vector_use_type_backend
 {
     sqlite3_vector_use_type_backend(sqlite3_statement_backend &st)
-        : statement_(st), data_(0), type_(), position_(0)
+        : statement_(st), data_(0), type_(), position_(0),
+          binder_(NULL), ind_(NULL)
     {
     }
 
@@ -148,12 +155,27 @@ struct sqlite3_vector_use_type_backend : details::vector_use_type_backend
 
     void clean_up() SOCI_OVERRIDE;
 
+    // Bind the vector element with the given index directly to the statement
+    // and return the SQLite result code.
+    int bind_element(std::size_t i) const;
+
     sqlite3_statement_backend &statement_;
 
     void *data_;
     details::exchange_type type_;
     int position_;
     std::string name_;
+
+    // Function binding the element of the vector of type_, set by pre_use().
+    typedef int (*binder_type)(sqlite3_vector_use_type_backend const &,
+                               std::size_t);
+    binder_type binder_;
+
+    indicator const *ind_;
+
+    // The values of x_stdtm elements formatted as strings, reused by all
+    // executions of the statement.
+    std::vector<char> dates_;
 };
 
 struct sqlite3_column_buffer
@@ -183,6 +205,52 @@ struct sqlite3_column
 typedef std::vector<sqlite3_column> sqlite3_row;
 typedef std::vector<sqlite3_row> sqlite3_recordset;
 
+// Storage for the rows fetched by a bulk operation.
+//
+// The columns of all rows are stored in a single row-major array of
+// fixed-size cells and the data of all variable-length values (strings, dates
+// and blobs) in a single contiguous byte buffer. Both of them are only reset,
+// and not freed, when the next batch of rows is loaded, so that no memory
+// allocations are needed once they have grown big enough.
+class sqlite3_rowset_arena
+{
+public:
+    sqlite3_rowset_arena() : bytesUsed_(0), numRows_(0), numCols_(0) {}
+
+    // Discard all the rows and prepare for storing rows of the given number
+    // of columns.
+    void reset(int numCols);
+
+    // Append a new row, whose cells must be filled by the caller, and return
+    // the pointer to its first cell.
+    sqlite3_column* add_row();
+
+    // Copy the variable-length data of the given cell, whose type must have
+    // been already set, to the byte buffer. Text data is NUL-terminated.
+    void set_buffer(sqlite3_column& col, void const* data, std::size_t size);
+
+    // Must be called after adding all rows and before accessing them, as
+    // the buffers of the cells are only valid after it.
+    void finish();
+
+    int size() const { return numRows_; }
+
+    sqlite3_column& get(int row, int col)
+    {
+        return cells_[static_cast<std::size_t>(row) * numCols_ + col];
+    }
+
+private:
+    std::vector<sqlite3_column> cells_;
+    std::vector<char> bytes_;
+
+    // Size of the used part of bytes_.
+    std::size_t bytesUsed_;
+
+    int numRows_;
+    int numCols_;
+};
+
 
 struct sqlite3_column_info
 {
@@ -216,6 +284,8 @@ struct sqlite3_statement_backend : details::statement_backend
     void describe_column(int colNum, data_type &dtype,
                                 std::string &columnName) SOCI_OVERRIDE;
 
+    void set_timeout(int milliseconds) SOCI_OVERRIDE;
+
     sqlite3_standard_into_type_backend * make_into_type_backend() SOCI_OVERRIDE;
     sqlite3_standard_use_type_backend * make_use_type_backend() SOCI_OVERRIDE;
     sqlite3_vector_into_type_backend * make_vector_into_type_backend() SOCI_OVERRIDE;
@@ -223,8 +293,17 @@ struct sqlite3_statement_backend : details::statement_backend
 
     sqlite3_session_backend &session_;
     sqlite_api::sqlite3_stmt *stmt_;
-    sqlite3_recordset dataCache_;
+
+    // SQL used to prepare stmt_, used as the key in the statement cache.
+    std::string query_;
+    sqlite3_rowset_arena dataCache_;
+
+    // Values of the scalar use elements.
     sqlite3_recordset useData_;
+
+    // Vector use elements, which are bound directly from the user vectors.
+    std::vector<sqlite3_vector_use_type_backend *> vectorUses_;
+
     bool databaseReady_;
     bool boundByName_;
     bool boundByPos_;
@@ -237,6 +316,25 @@ private:
     exec_fetch_result load_rowset(int totalRows);
     exec_fetch_result load_one();
     exec_fetch_result bind_and_execute(int number);
+    void bind_scalars();
+
+    // Return the result of the prefetched step, if any, or step the
+    // statement.
+    int step();
+
+    // Execute the statement to retrieve its first row if possible, this is
+    // used by describe_column() to examine the values when the declared
+    // column type is unknown.
+    bool prefetch_first_row();
+
+    // If true, the statement was already stepped once by describe_column()
+    // and prefetchResult_ contains the result of this step.
+    bool firstRowPrefetched_;
+    int prefetchResult_;
+
+    // Maximal duration of each execute() or fetch() call in milliseconds, or
+    // 0 if they're not limited.
+    int timeout_;
 };
 
 struct sqlite3_rowid_backend : details::rowid_backend
@@ -248,7 +346,18 @@ struct sqlite3_rowid_backend : details::rowid_backend
     unsigned long value_;
 };
 
-struct sqlite3_blob_backend : details::blob_backend
+// By default, the blob data is kept in memory and is written to or read from
+// the database as a whole when the blob is used with a statement.
+//
+// Alternatively, open() or create() can be used to switch the blob to the
+// incremental I/O mode in which it is bound to the given column of an existing
+// row and all operations on it read and write the database directly. This
+// uses a constant amount of memory independently of the blob size, however
+// the size of the blob can't be changed in this mode: write() can't write past
+// its end, append() can only fill the space preallocated by create() (or by
+// using zeroblob() SQL function), writing the data after the end of the
+// previously appended data, and trim() is not supported at all.
+struct SOCI_SQLITE3_DECL sqlite3_blob_backend : details::blob_backend
 {
     sqlite3_blob_backend(sqlite3_session_backend &session);
 
@@ -257,19 +366,124 @@ struct sqlite3_blob_backend : details::blob_backend
     std::size_t get_len() SOCI_OVERRIDE;
     std::size_t read(std::size_t offset, char *buf,
                              std::size_t toRead) SOCI_OVERRIDE;
+    std::size_t read_from_start(char *buf, std::size_t toRead,
+                             std::size_t offset) SOCI_OVERRIDE;
     std::size_t write(std::size_t offset, char const *buf,
                               std::size_t toWrite) SOCI_OVERRIDE;
+    std::size_t write_from_start(char const *buf, std::size_t toWrite,
+                              std::size_t offset) SOCI_OVERRIDE;
     std::size_t append(char const *buf, std::size_t toWrite) SOCI_OVERRIDE;
     void trim(std::size_t newLen) SOCI_OVERRIDE;
 
+    // Open the blob stored in the given column of the row with the given
+    // rowid for incremental I/O.
+    void open(std::string const &table, std::string const &column,
+              sqlite_api::sqlite3_int64 rowid, bool readOnly = false);
+
+    // Replace the value of the given column of the row with the given rowid
+    // with a blob of the given size filled with zeroes and open it for
+    // writing.
+    void create(std::string const &table, std::string const &column,
+                sqlite_api::sqlite3_int64 rowid, std::size_t size);
+
+    // Close the blob opened for incremental I/O, if any, and switch back to
+    // the default mode with an empty blob.
+    void close();
+
+    bool is_open() const { return blob_ != NULL; }
+
     sqlite3_session_backend &session_;
 
     std::size_t set_data(char const *buf, std::size_t toWrite);
-    const char *get_buffer() const { return buf_; }
+    const char *get_buffer() const { return buf_.empty() ? NULL : &buf_[0]; }
 
 private:
-    char *buf_;
-    size_t len_;
+    void check_result(int res, char const *operation);
+
+    // Used in the default mode, the size of this vector may be greater than
+    // the length of the blob to make appending to it more efficient.
+    std::vector<char> buf_;
+    std::size_t len_;
+
+    // Used in the incremental I/O mode only.
+    sqlite_api::sqlite3_blob *blob_;
+    std::size_t appendPos_;
+    bool readOnly_;
+};
+
+// Statistics of sqlite3_statement_cache usage.
+struct sqlite3_statement_cache_stats
+{
+    sqlite3_statement_cache_stats() : hits(0), misses(0), evictions(0) {}
+
+    // Number of prepared statements reused from the cache.
+    unsigned long long hits;
+
+    // Number of statements which had to be prepared because they were not
+    // found in the cache.
+    unsigned long long misses;
+
+    // Number of statements finalized because the cache was full.
+    unsigned long long evictions;
+};
+
+// Cache of the prepared statements which are not used any more, indexed by
+// their SQL text.
+//
+// When a statement backend is cleaned up, its statement is reset and
+// returned to the cache instead of being finalized and it is reused when a
+// statement with the same SQL is prepared later, avoiding parsing and
+// planning it again. When the cache is full, the least recently returned
+// statement is finalized.
+class SOCI_SQLITE3_DECL sqlite3_statement_cache
+{
+public:
+    explicit sqlite3_statement_cache(std::size_t maxSize);
+    ~sqlite3_statement_cache();
+
+    // Remove the statement with the given SQL from the cache and return it
+    // or return NULL if there is no such statement.
+    sqlite_api::sqlite3_stmt *take(std::string const &query);
+
+    // Put the statement into the cache: it will be reset and its bindings
+    // cleared. The statement is finalized if the cache is disabled.
+    void put(std::string const &query, sqlite_api::sqlite3_stmt *stmt);
+
+    // Finalize all the statements in the cache.
+    void clear();
+
+    // Change the maximal number of statements, 0 disables the cache.
+    void set_max_size(std::size_t maxSize);
+    std::size_t get_max_size() const { return maxSize_; }
+
+    // Number of statements currently in the cache.
+    std::size_t size() const { return lru_.size(); }
+
+    sqlite3_statement_cache_stats const &get_stats() const { return stats_; }
+    void reset_stats() { stats_ = sqlite3_statement_cache_stats(); }
+
+private:
+    struct entry
+    {
+        std::string query;
+        sqlite_api::sqlite3_stmt *stmt;
+    };
+
+    // The most recently returned statements come first.
+    typedef std::list<entry> entries;
+    entries lru_;
+
+    // There may be more than one cached statement with the same SQL if
+    // several statements using it were alive at the same time.
+    typedef std::multimap<std::string, entries::iterator> index;
+    index index_;
+
+    std::size_t maxSize_;
+    sqlite3_statement_cache_stats stats_;
+
+    void evict_last();
+
+    SOCI_NOT_COPYABLE(sqlite3_statement_cache)
 };
 
 struct sqlite3_session_backend : details::session_backend
@@ -280,6 +494,8 @@ struct sqlite3_session_backend : details::session_backend
 
     bool is_connected() SOCI_OVERRIDE { return true; }
 
+    void cancel() SOCI_OVERRIDE;
+
     void begin() SOCI_OVERRIDE;
     void commit() SOCI_OVERRIDE;
     void rollback() SOCI_OVERRIDE;
@@ -328,6 +544,175 @@ struct sqlite3_session_backend : details::session_backend
 
     }
     sqlite_api::sqlite3 *conn_;
+
+    // If true (default), bulk operations are executed inside a savepoint.
+    bool bulkTransactions_;
+
+    // The way std::tm values are stored in the database: by default they're
+    // stored as text, but they can also be stored as integer number of
+    // seconds or microseconds since Unix epoch.
+    enum date_storage
+    {
+        date_as_text,
+        date_as_epoch_seconds,
+        date_as_epoch_microseconds
+    };
+    date_storage dateStorage_;
+
+    // Return the number of units per second used for dates stored as
+    // integers: this is also used for reading integer values into std::tm
+    // when dates are stored as text.
+    long long get_date_epoch_scale() const
+    {
+        return dateStorage_ == date_as_epoch_microseconds ? 1000000 : 1;
+    }
+
+    // Cache of the prepared statements reused by the statement backends.
+    sqlite3_statement_cache statementCache_;
+};
+
+// Reference to a text or blob value of the current row stored by SQLite
+// itself, allowing to read it without copying it.
+//
+// The value is only valid until the statement is executed or fetched from
+// again, or is destroyed, and accessing it after the statement destruction
+// throws an exception. Notably, this means that it can't be used with the
+// one-time queries, such as "sql << query, into(view)", but only with the
+// prepared statement objects.
+class SOCI_SQLITE3_DECL sqlite3_column_view
+{
+public:
+    sqlite3_column_view() : data_(NULL), size_(0), valid_(false) {}
+
+    // Return the data, which is NUL-terminated for text values, or NULL if
+    // the value is NULL.
+    char const *data() const { check_valid(); return data_; }
+    std::size_t size() const { check_valid(); return size_; }
+
+    std::string str() const { check_valid(); return std::string(data_, size_); }
+
+private:
+    void check_valid() const;
+
+    char const *data_;
+    std::size_t size_;
+    bool valid_;
+
+    friend class sqlite3_column_view_into_type;
+};
+
+SOCI_SQLITE3_DECL details::into_type_ptr into(sqlite3_column_view &v);
+SOCI_SQLITE3_DECL details::into_type_ptr into(sqlite3_column_view &v,
+                                              indicator &ind);
+
+// Pools of sessions for using a database in WAL journal mode from multiple
+// threads: any number of read-only sessions can be used concurrently, while
+// the only writer session is shared by all threads modifying the database,
+// so that they never compete for the write lock.
+//
+// All sessions use memory-mapped I/O and a bigger page cache by default,
+// these settings can be overridden in the connection string.
+class SOCI_SQLITE3_DECL sqlite3_wal_pool
+{
+public:
+    // The connection string is either just the database file name or a
+    // connection string in the usual format, which must not include
+    // "readonly" option.
+    sqlite3_wal_pool(std::string const & connectString, std::size_t readers);
+
+    // Construct soci::session from the pool returned by these functions to
+    // lease a session from it, e.g.
+    //
+    //      session sql(pool.readers());
+    connection_pool & readers() { return readers_; }
+    connection_pool & writer() { return writer_; }
+
+private:
+    // The writer is declared first to be closed last, as only it can remove
+    // the WAL files.
+    connection_pool writer_;
+    connection_pool readers_;
+
+    SOCI_NOT_COPYABLE(sqlite3_wal_pool)
+};
+
+// Callback interface for reporting the progress of sqlite3_backup_copy::run().
+class SOCI_SQLITE3_DECL sqlite3_backup_progress
+{
+public:
+    virtual ~sqlite3_backup_progress() {}
+
+    // Called after each step with the number of pages still remaining to be
+    // copied and the total number of pages in the source database.
+    virtual void on_step(int remaining, int total) = 0;
+};
+
+// Copy of a database using SQLite online backup API.
+//
+// The copy can be done all at once or incrementally, a few pages at a time,
+// in which case the source database is only locked while each step is
+// executed and can be modified by the other connections in the meanwhile
+// (but then the copy is restarted from the beginning by SQLite itself, unless
+// the source is modified using the same connection).
+//
+// The destination database is replaced with the copy entirely.
+class SOCI_SQLITE3_DECL sqlite3_backup_copy
+{
+public:
+    // Copy the main database of the source session into the destination one.
+    sqlite3_backup_copy(session & destination, session & source);
+
+    // Copy between the main database of the session and the given file.
+    enum direction
+    {
+        load_from_file,
+        save_to_file
+    };
+    sqlite3_backup_copy(session & sql, std::string const & fileName,
+                        direction dir);
+
+    // Abandons the copy if it wasn't finished yet.
+    ~sqlite3_backup_copy();
+
+    // Copy at most the given number of pages, or all the remaining pages if
+    // it is negative, and return true if the copy is complete. If the source
+    // or destination database is temporarily locked, just returns false and
+    // the step should be retried later.
+    bool step(int pages = -1);
+
+    // Copy everything, performing steps of the given size and waiting for
+    // the given number of milliseconds between them to let the other
+    // connections use the database. The optional progress callback is
+    // called after each step.
+    void run(int pagesPerStep = -1, int sleepMs = 0,
+             sqlite3_backup_progress * progress = NULL);
+
+    // Number of pages remaining to be copied and the total number of pages,
+    // only known after the first step.
+    int remaining() const { return remaining_; }
+    int page_count() const { return pageCount_; }
+
+    bool done() const { return done_; }
+
+private:
+    void init(sqlite_api::sqlite3 * destination, sqlite_api::sqlite3 * source);
+    void finish();
+
+    // Perform a step and return SQLite result code.
+    int do_step(int pages);
+
+    // Connection to the file opened by this object, if any.
+    sqlite_api::sqlite3 * file_;
+
+    // Destination connection, used for error reporting.
+    sqlite_api::sqlite3 * destination_;
+
+    sqlite_api::sqlite3_backup * backup_;
+    int remaining_;
+    int pageCount_;
+    bool done_;
+
+    SOCI_NOT_COPYABLE(sqlite3_backup_copy)
 };
 
 struct sqlite3_backend_factory : backend_factory
@@ -8,6 +8,7 @@
 #ifndef SOCI_STATEMENT_H_INCLUDED
 #define SOCI_STATEMENT_H_INCLUDED
 
+#include "soci/async-result.h"
 #include "soci/bind-values.h"
 #include "soci/into-type.h"
 #include "soci/into.h"
@@ -33,6 +34,7 @@ namespace details
 class into_type_base;
 class use_type_base;
 class prepare_temp_type;
+class async_operation;
 
 class SOCI_DECL statement_impl
 {
@@ -63,8 +65,16 @@ public:
     void define_and_bind();
     void undefine_and_bind();
     bool execute(bool withDataExchange = false);
+
+    // If gotData is non-NULL, it is updated by async_result::get(), unless
+    // forget_got_data() is called with the same pointer before it.
+    async_result execute_async(bool withDataExchange = false,
+        bool * gotData = NULL);
     long long get_affected_rows();
+    void set_timeout(int milliseconds);
     bool fetch();
+    async_result fetch_async(bool * gotData = NULL);
+    void forget_got_data(bool * gotData);
     void describe();
     void set_row(row * r);
     void exchange_for_rowset(into_type_ptr const & i) { exchange_for_rowset_(i); }
@@ -100,13 +110,36 @@ private:
     // applicable, its parameters.
     SOCI_NORETURN rethrow_current_exception_with_context(char const* operation);
 
+    // Both execute() and execute_async() are implemented using these
+    // functions: the first one prepares everything for calling the backend
+    // execute() and returns the number of rows to pass to it, and the second
+    // one processes its result. The start time is only used for statistics.
+    int start_execute(bool withDataExchange);
+    bool finish_execute(int num, statement_backend::exec_fetch_result res,
+        long long startTime);
+
+    // Same as above for fetch(), start_fetch() returns 0 if there is nothing
+    // to fetch any more and the backend fetch() must not be called.
+    std::size_t start_fetch();
+    bool finish_fetch(statement_backend::exec_fetch_result res,
+        long long startTime);
+
+    friend class async_operation;
+
     int refCount_;
 
+    // All asynchronous operations on this statement which still exist: they
+    // may update got data flags of different statement objects sharing it.
+    std::vector<async_operation *> asyncOperations_;
+
     row * row_;
     std::size_t fetchSize_;
     std::size_t initialFetchSize_;
     std::string query_;
 
+    // normalized query used for statistics, only computed if needed
+    std::string fingerprint_;
+
     into_type_vector intosForRow_;
     int definePositionForRow_;
 
@@ -158,6 +191,8 @@ private:
     void post_use(bool gotData);
     bool resize_intos(std::size_t upperBound = 0);
     void truncate_intos();
+    std::string const & get_fingerprint();
+    std::size_t fetched_data_size();
 
     soci::details::statement_backend * backEnd_;
 
@@ -175,7 +210,11 @@ public:
         : impl_(new details::statement_impl(s)), gotData_(false) {}
     statement(details::prepare_temp_type const & prep)
         : impl_(new details::statement_impl(prep)), gotData_(false) {}
-    ~statement() { impl_->dec_ref(); }
+    ~statement()
+    {
+        impl_->forget_got_data(&gotData_);
+        impl_->dec_ref();
+    }
 
     // copy is supported for this handle class
     statement(statement const & other)
@@ -187,6 +226,7 @@ public:
     void operator=(statement const & other)
     {
         other.impl_->inc_ref();
+        impl_->forget_got_data(&gotData_);
         impl_->dec_ref();
         impl_ = other.impl_;
         gotData_ = other.gotData_;
@@ -222,12 +262,32 @@ public:
         return impl_->get_affected_rows();
     }
 
+    // Limit the time taken by each subsequent execution of the statement (and
+    // also each fetch for some backends), 0 means no limit. The statement
+    // throws soci_error with query_cancelled category if it is exceeded.
+    void set_timeout(int milliseconds)
+    {
+        impl_->set_timeout(milliseconds);
+    }
+
     bool fetch()
     {
         gotData_ = impl_->fetch();
         return gotData_;
     }
 
+    // Asynchronous versions of execute() and fetch(), see async_result.
+    // got_data() is updated when async_result::get() is called.
+    async_result execute_async(bool withDataExchange = false)
+    {
+        return impl_->execute_async(withDataExchange, &gotData_);
+    }
+
+    async_result fetch_async()
+    {
+        return impl_->fetch_async(&gotData_);
+    }
+
     bool got_data() const { return gotData_; }
 
     void describe()       { impl_->describe(); }
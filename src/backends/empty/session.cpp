@@ -7,6 +7,10 @@
 
 #define SOCI_EMPTY_SOURCE
 #include "soci/empty/soci-empty.h"
+#include "soci/connection-parameters.h"
+
+#include <cstdlib>
+#include <sstream>
 
 #ifdef _MSC_VER
 #pragma warning(disable:4355)
@@ -16,10 +20,81 @@ using namespace soci;
 using namespace soci::details;
 
 
+namespace // anonymous
+{
+
+std::size_t parse_size(std::string const & name, std::string const & value)
+{
+    char * end;
+    long const n = std::strtol(value.c_str(), &end, 10);
+    if (value.empty() || *end != '\0' || n < 0)
+    {
+        throw soci_error("Invalid value \"" + value + "\" of \"" + name +
+            "\" option of the empty backend.");
+    }
+
+    return static_cast<std::size_t>(n);
+}
+
+data_type parse_data_type(std::string const & name)
+{
+    if (name == "string")
+        return dt_string;
+    if (name == "date")
+        return dt_date;
+    if (name == "double")
+        return dt_double;
+    if (name == "integer")
+        return dt_integer;
+    if (name == "long_long")
+        return dt_long_long;
+    if (name == "unsigned_long_long")
+        return dt_unsigned_long_long;
+
+    throw soci_error("Unsupported column type \"" + name +
+        "\" in the empty backend connect string.");
+}
+
+} // namespace anonymous
+
 empty_session_backend::empty_session_backend(
-    connection_parameters const & /* parameters */)
+    connection_parameters const & parameters)
 {
-    // ...
+    empty_result_set resultSet;
+
+    std::istringstream iss(parameters.get_connect_string());
+    std::string word;
+    while (iss >> word)
+    {
+        std::string::size_type const pos = word.find('=');
+        if (pos == std::string::npos)
+            continue;
+
+        std::string const name = word.substr(0, pos);
+        std::string const value = word.substr(pos + 1);
+        if (name == "rows")
+        {
+            resultSet.rows = parse_size(name, value);
+        }
+        else if (name == "string_size")
+        {
+            resultSet.stringSize = parse_size(name, value);
+        }
+        else if (name == "columns")
+        {
+            std::istringstream types(value);
+            std::string type;
+            while (std::getline(types, type, ','))
+                resultSet.columns.push_back(parse_data_type(type));
+        }
+        else
+        {
+            throw soci_error("Unknown option \"" + name +
+                "\" in the empty backend connect string.");
+        }
+    }
+
+    set_result_set(resultSet);
 }
 
 empty_session_backend::~empty_session_backend()
@@ -47,6 +122,12 @@ void empty_session_backend::clean_up()
     // ...
 }
 
+void empty_session_backend::set_result_set(empty_result_set const & resultSet)
+{
+    resultSet_ = resultSet;
+    stringValue_.assign(resultSet_.stringSize, 'x');
+}
+
 empty_statement_backend * empty_session_backend::make_statement_backend()
 {
     return new empty_statement_backend(*this);
@@ -17,9 +17,13 @@ using namespace soci::details;
 
 
 void empty_standard_into_type_backend::define_by_pos(
-    int & /* position */, void * /* data */, exchange_type /* type */)
+    int & position, void * data, exchange_type type)
 {
-    // ...
+    data_ = data;
+    type_ = type;
+    position_ = position++;
+
+    statement_.intosCount_++;
 }
 
 void empty_standard_into_type_backend::pre_fetch()
@@ -28,12 +32,22 @@ void empty_standard_into_type_backend::pre_fetch()
 }
 
 void empty_standard_into_type_backend::post_fetch(
-    bool /* gotData */, bool /* calledFromFetch */, indicator * /* ind */)
+    bool gotData, bool /* calledFromFetch */, indicator * ind)
 {
-    // ...
+    if (!gotData)
+        return;
+
+    statement_.get_value(statement_.firstRow_, position_, data_, type_);
+
+    if (ind != NULL)
+        *ind = i_ok;
 }
 
 void empty_standard_into_type_backend::clean_up()
 {
-    // ...
+    if (data_ != NULL)
+    {
+        statement_.intosCount_--;
+        data_ = NULL;
+    }
 }
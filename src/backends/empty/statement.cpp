@@ -7,6 +7,10 @@
 
 #define SOCI_EMPTY_SOURCE
 #include "soci/empty/soci-empty.h"
+#include "soci-exchange-cast.h"
+
+#include <cstring>
+#include <sstream>
 
 #ifdef _MSC_VER
 #pragma warning(disable:4355)
@@ -17,7 +21,8 @@ using namespace soci::details;
 
 
 empty_statement_backend::empty_statement_backend(empty_session_backend &session)
-    : session_(session)
+    : session_(session), intosCount_(0),
+      firstRow_(0), rowsFetched_(0), nextRow_(0), affectedRows_(-1)
 {
 }
 
@@ -34,33 +39,53 @@ void empty_statement_backend::clean_up()
 void empty_statement_backend::prepare(std::string const & /* query */,
     statement_type /* eType */)
 {
-    // ...
+    firstRow_ = 0;
+    rowsFetched_ = 0;
+    nextRow_ = 0;
+    affectedRows_ = -1;
 }
 
 statement_backend::exec_fetch_result
-empty_statement_backend::execute(int /* number */)
+empty_statement_backend::execute(int number)
 {
-    // ...
-    return ef_success;
+    if (intosCount_ == 0)
+    {
+        // Pretend that all the rows of the bulk operation were affected.
+        affectedRows_ = number;
+        rowsFetched_ = 0;
+        return ef_success;
+    }
+
+    affectedRows_ = 0;
+    nextRow_ = 0;
+    return fetch(number);
 }
 
 statement_backend::exec_fetch_result
-empty_statement_backend::fetch(int /* number */)
+empty_statement_backend::fetch(int number)
 {
-    // ...
-    return ef_success;
+    std::size_t const rows = session_.get_result_set().rows;
+    std::size_t const wanted = static_cast<std::size_t>(number);
+
+    // The result set could have been changed to have fewer rows since the
+    // statement execution.
+    std::size_t const remaining = nextRow_ < rows ? rows - nextRow_ : 0;
+
+    firstRow_ = nextRow_;
+    rowsFetched_ = remaining < wanted ? remaining : wanted;
+    nextRow_ += rowsFetched_;
+
+    return rowsFetched_ == wanted ? ef_success : ef_no_data;
 }
 
 long long empty_statement_backend::get_affected_rows()
 {
-    // ...
-    return -1;
+    return affectedRows_;
 }
 
 int empty_statement_backend::get_number_of_rows()
 {
-    // ...
-    return 1;
+    return static_cast<int>(rowsFetched_);
 }
 
 std::string empty_statement_backend::get_parameter_name(int /* index */) const
@@ -77,14 +102,70 @@ std::string empty_statement_backend::rewrite_for_procedure_call(
 
 int empty_statement_backend::prepare_for_describe()
 {
-    // ...
-    return 0;
-}
-
-void empty_statement_backend::describe_column(int /* colNum */,
-    data_type & /* type */, std::string & /* columnName */)
-{
-    // ...
+    return static_cast<int>(session_.get_result_set().columns.size());
+}
+
+void empty_statement_backend::describe_column(int colNum,
+    data_type & type, std::string & columnName)
+{
+    type = session_.get_result_set().columns.at(colNum - 1);
+
+    std::ostringstream oss;
+    oss << 'c' << colNum;
+    columnName = oss.str();
+}
+
+void empty_statement_backend::get_value(std::size_t row, int position,
+    void * data, exchange_type type) const
+{
+    std::vector<data_type> const & columns = session_.get_result_set().columns;
+    if (position < 1 || static_cast<std::size_t>(position) > columns.size())
+        return;
+
+    switch (type)
+    {
+        case x_char:
+            exchange_type_cast<x_char>(data) = session_.get_string_value().empty()
+                ? '\0' : session_.get_string_value()[0];
+            break;
+        case x_stdstring:
+            exchange_type_cast<x_stdstring>(data) = session_.get_string_value();
+            break;
+        case x_short:
+            exchange_type_cast<x_short>(data) = static_cast<short>(row);
+            break;
+        case x_integer:
+            exchange_type_cast<x_integer>(data) = static_cast<int>(row);
+            break;
+        case x_long_long:
+            exchange_type_cast<x_long_long>(data) = static_cast<long long>(row);
+            break;
+        case x_unsigned_long_long:
+            exchange_type_cast<x_unsigned_long_long>(data) = row;
+            break;
+        case x_double:
+            exchange_type_cast<x_double>(data) = row + 0.5;
+            break;
+        case x_stdtm:
+            {
+                std::tm& t = exchange_type_cast<x_stdtm>(data);
+                std::memset(&t, 0, sizeof(t));
+                t.tm_year = 100;
+                t.tm_mon = 0;
+                t.tm_mday = 1;
+            }
+            break;
+        case x_xmltype:
+            exchange_type_cast<x_xmltype>(data).value = session_.get_string_value();
+            break;
+        case x_longstring:
+            exchange_type_cast<x_longstring>(data).value = session_.get_string_value();
+            break;
+        case x_statement:
+        case x_rowid:
+        case x_blob:
+            break;
+    }
 }
 
 empty_standard_into_type_backend * empty_statement_backend::make_into_type_backend()
@@ -7,15 +7,59 @@
 
 #define SOCI_EMPTY_SOURCE
 #include "soci/empty/soci-empty.h"
+#include "soci-vector-helpers.h"
 
 using namespace soci;
 using namespace soci::details;
 
 
+namespace // anonymous
+{
+
+// Return the address of the element of the vector of the given type.
+void * vector_element(exchange_type type, void * data, std::size_t i)
+{
+    switch (type)
+    {
+        case x_char:
+            return &exchange_vector_type_cast<x_char>(data)[i];
+        case x_stdstring:
+            return &exchange_vector_type_cast<x_stdstring>(data)[i];
+        case x_short:
+            return &exchange_vector_type_cast<x_short>(data)[i];
+        case x_integer:
+            return &exchange_vector_type_cast<x_integer>(data)[i];
+        case x_long_long:
+            return &exchange_vector_type_cast<x_long_long>(data)[i];
+        case x_unsigned_long_long:
+            return &exchange_vector_type_cast<x_unsigned_long_long>(data)[i];
+        case x_double:
+            return &exchange_vector_type_cast<x_double>(data)[i];
+        case x_stdtm:
+            return &exchange_vector_type_cast<x_stdtm>(data)[i];
+        case x_xmltype:
+            return &exchange_vector_type_cast<x_xmltype>(data)[i];
+        case x_longstring:
+            return &exchange_vector_type_cast<x_longstring>(data)[i];
+        case x_statement:
+        case x_rowid:
+        case x_blob:
+            break;
+    }
+
+    throw soci_error("Into element used with non-supported type.");
+}
+
+} // namespace anonymous
+
 void empty_vector_into_type_backend::define_by_pos(
-    int & /* position */, void * /* data */, exchange_type /* type */)
+    int & position, void * data, exchange_type type)
 {
-    // ...
+    data_ = data;
+    type_ = type;
+    position_ = position++;
+
+    statement_.intosCount_++;
 }
 
 void empty_vector_into_type_backend::pre_fetch()
@@ -24,23 +68,37 @@ void empty_vector_into_type_backend::pre_fetch()
 }
 
 void empty_vector_into_type_backend::post_fetch(
-    bool /* gotData */, indicator * /* ind */)
+    bool gotData, indicator * ind)
 {
-    // ...
+    if (!gotData)
+        return;
+
+    std::size_t const rows = statement_.rowsFetched_;
+    for (std::size_t i = 0; i != rows; ++i)
+    {
+        statement_.get_value(statement_.firstRow_ + i, position_,
+            vector_element(type_, data_, i), type_);
+
+        if (ind != NULL)
+            ind[i] = i_ok;
+    }
 }
 
-void empty_vector_into_type_backend::resize(std::size_t /* sz */)
+void empty_vector_into_type_backend::resize(std::size_t sz)
 {
-    // ...
+    resize_vector(type_, data_, sz);
 }
 
 std::size_t empty_vector_into_type_backend::size()
 {
-    // ...
-    return 1;
+    return get_vector_size(type_, data_);
 }
 
 void empty_vector_into_type_backend::clean_up()
 {
-    // ...
+    if (data_ != NULL)
+    {
+        statement_.intosCount_--;
+        data_ = NULL;
+    }
 }
@@ -7,6 +7,7 @@
 
 #define SOCI_EMPTY_SOURCE
 #include "soci/empty/soci-empty.h"
+#include "soci-vector-helpers.h"
 
 #ifdef _MSC_VER
 #pragma warning(disable:4355)
@@ -16,17 +17,20 @@ using namespace soci;
 using namespace soci::details;
 
 
-void empty_vector_use_type_backend::bind_by_pos(int & /* position */,
-        void * /* data */, exchange_type /* type */)
+void empty_vector_use_type_backend::bind_by_pos(int & position,
+        void * data, exchange_type type)
 {
-    // ...
+    data_ = data;
+    type_ = type;
+    position++;
 }
 
 void empty_vector_use_type_backend::bind_by_name(
-    std::string const & /* name */, void * /* data */,
-    exchange_type /* type */)
+    std::string const & /* name */, void * data,
+    exchange_type type)
 {
-    // ...
+    data_ = data;
+    type_ = type;
 }
 
 void empty_vector_use_type_backend::pre_use(indicator const * /* ind */)
@@ -36,8 +40,7 @@ void empty_vector_use_type_backend::pre_use(indicator const * /* ind */)
 
 std::size_t empty_vector_use_type_backend::size()
 {
-    // ...
-    return 1;
+    return get_vector_size(type_, data_);
 }
 
 void empty_vector_use_type_backend::clean_up()
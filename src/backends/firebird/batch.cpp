@@ -0,0 +1,690 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Execution of statements with vector use elements, which is done using
+// IBatch interface with Firebird 4 and later or by combining several rows
+// into EXECUTE BLOCK statements otherwise.
+
+#define SOCI_FIREBIRD_SOURCE
+#include "soci/firebird/soci-firebird.h"
+#include "firebird/error-firebird.h"
+#include "soci-dtocstr.h"
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#if FB_API_VER >= 40
+#include <firebird/Interface.h>
+#endif
+
+using namespace soci;
+using namespace soci::details;
+using namespace soci::details::firebird;
+
+namespace // anonymous
+{
+
+// Maximal length of a single EXECUTE BLOCK statement, the length of the
+// statement text passed to isc_dsql_exec_immed2() can't exceed 64KiB.
+std::size_t const maxBlockLength = 60000;
+
+// Maximal number of rows in a single EXECUTE BLOCK: each statement inside it
+// uses at least one context and there can be at most 255 of them per request.
+// Statements using more than two contexts, e.g. because of subqueries, may
+// still exceed this limit, see the fallback in executeBlocks().
+std::size_t const maxBlockRows = 100;
+
+// Split the query into the parts between its parameters, return false if the
+// number of parameters doesn't match the expected one.
+bool splitQuery(std::string const & query, std::size_t params,
+    std::vector<std::string> & parts)
+{
+    parts.clear();
+    parts.push_back(std::string());
+
+    // Either the closing quote of a literal or identifier, or '\n' for a
+    // single line comment or '*' for a multi-line one.
+    char quote = '\0';
+    for (std::string::const_iterator it = query.begin(); it != query.end(); ++it)
+    {
+        char const c = *it;
+        std::string::const_iterator const next = it + 1;
+        if (quote == '*')
+        {
+            if (c == '*' && next != query.end() && *next == '/')
+            {
+                parts.back() += c;
+                ++it;
+                quote = '\0';
+            }
+        }
+        else if (quote != '\0')
+        {
+            if (c == quote)
+                quote = '\0';
+        }
+        else if (c == '\'' || c == '"')
+        {
+            quote = c;
+        }
+        else if (c == '-' && next != query.end() && *next == '-')
+        {
+            quote = '\n';
+        }
+        else if (c == '/' && next != query.end() && *next == '*')
+        {
+            parts.back() += c;
+            ++it;
+            quote = '*';
+        }
+        else if (c == '?')
+        {
+            parts.push_back(std::string());
+            continue;
+        }
+
+        parts.back() += c;
+    }
+
+    return parts.size() == params + 1;
+}
+
+void appendScaled(std::string & out, long long value, short scale)
+{
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%lld", value);
+
+    std::string digits(buf[0] == '-' ? buf + 1 : buf);
+    if (buf[0] == '-')
+        out += '-';
+
+    if (scale >= 0)
+    {
+        out += digits;
+        out.append(static_cast<std::size_t>(scale), '0');
+        return;
+    }
+
+    std::size_t const decimals = static_cast<std::size_t>(-scale);
+    if (digits.size() <= decimals)
+        digits.insert(0, decimals - digits.size() + 1, '0');
+
+    out.append(digits, 0, digits.size() - decimals);
+    out += '.';
+    out.append(digits, digits.size() - decimals, decimals);
+}
+
+void appendTime(std::string & out, std::tm const & t, ISC_TIME time,
+    bool withDate, bool withTime)
+{
+    char buf[64];
+    int len = 0;
+
+    if (withDate)
+    {
+        len += snprintf(buf + len, sizeof(buf) - len, "%04d-%02d-%02d",
+            t.tm_year + 1900, t.tm_mon + 1, t.tm_mday);
+    }
+
+    if (withTime)
+    {
+        len += snprintf(buf + len, sizeof(buf) - len, "%s%02d:%02d:%02d.%04d",
+            withDate ? " " : "", t.tm_hour, t.tm_min, t.tm_sec,
+            static_cast<int>(time % 10000));
+    }
+
+    out += '\'';
+    out.append(buf, static_cast<std::size_t>(len));
+    out += '\'';
+}
+
+void appendText(std::string & out, char const * s, std::size_t len,
+    bool binary)
+{
+    if (binary)
+    {
+        static char const hexDigits[] = "0123456789ABCDEF";
+
+        out += "X'";
+        for (std::size_t i = 0; i != len; ++i)
+        {
+            unsigned char const c = static_cast<unsigned char>(s[i]);
+            out += hexDigits[c >> 4];
+            out += hexDigits[c & 0x0F];
+        }
+        out += '\'';
+        return;
+    }
+
+    out += '\'';
+    for (std::size_t i = 0; i != len; ++i)
+    {
+        if (s[i] == '\'')
+            out += '\'';
+        out += s[i];
+    }
+    out += '\'';
+}
+
+// Append the SQL literal corresponding to the current value of the given
+// parameter, return false if it can't be represented as a literal.
+bool appendLiteral(std::string & out, XSQLVAR const & var)
+{
+    if (var.sqlind != NULL && *var.sqlind == -1)
+    {
+        out += "NULL";
+        return true;
+    }
+
+    char const * const data = var.sqldata;
+    switch (var.sqltype & ~1)
+    {
+        case SQL_SHORT:
+            {
+                short v;
+                std::memcpy(&v, data, sizeof(v));
+                appendScaled(out, v, var.sqlscale);
+            }
+            return true;
+
+        case SQL_LONG:
+            {
+                ISC_LONG v;
+                std::memcpy(&v, data, sizeof(v));
+                appendScaled(out, v, var.sqlscale);
+            }
+            return true;
+
+        case SQL_INT64:
+            {
+                ISC_INT64 v;
+                std::memcpy(&v, data, sizeof(v));
+                appendScaled(out, v, var.sqlscale);
+            }
+            return true;
+
+        case SQL_FLOAT:
+        case SQL_DOUBLE:
+            {
+                double v;
+                if ((var.sqltype & ~1) == SQL_FLOAT)
+                {
+                    float f;
+                    std::memcpy(&f, data, sizeof(f));
+                    v = f;
+                }
+                else
+                {
+                    std::memcpy(&v, data, sizeof(v));
+                }
+
+                // Infinities and NaN don't have any literal representation.
+                if (v - v != 0)
+                    return false;
+
+                // Use exponential notation to ensure that the literal is
+                // interpreted as a double and not an exact numeric value.
+                std::string const s = double_to_cstring(v);
+                out += s;
+                if (s.find_first_of("eE") == std::string::npos)
+                    out += "e0";
+            }
+            return true;
+
+        case SQL_TEXT:
+        case SQL_VARYING:
+            {
+                std::size_t len = static_cast<std::size_t>(var.sqllen);
+                char const * s = data;
+                if ((var.sqltype & ~1) == SQL_VARYING)
+                {
+                    short sz;
+                    std::memcpy(&sz, data, sizeof(sz));
+                    len = static_cast<std::size_t>(sz);
+                    s += sizeof(short);
+                }
+
+                // Character set 1 is OCTETS, use hexadecimal literal for it.
+                bool const binary = (var.sqlsubtype & 0xFF) == 1;
+
+                // Embedded NULs can't be used in string literals.
+                if (!binary && std::memchr(s, '\0', len) != NULL)
+                    return false;
+
+                appendText(out, s, len, binary);
+            }
+            return true;
+
+        case SQL_TYPE_DATE:
+            {
+                std::tm t;
+                isc_decode_sql_date(reinterpret_cast<ISC_DATE const *>(data), &t);
+                out += "DATE ";
+                appendTime(out, t, 0, true, false);
+            }
+            return true;
+
+        case SQL_TYPE_TIME:
+            {
+                ISC_TIME time;
+                std::memcpy(&time, data, sizeof(time));
+
+                std::tm t;
+                isc_decode_sql_time(&time, &t);
+                out += "TIME ";
+                appendTime(out, t, time, false, true);
+            }
+            return true;
+
+        case SQL_TIMESTAMP:
+            {
+                ISC_TIMESTAMP ts;
+                std::memcpy(&ts, data, sizeof(ts));
+
+                std::tm t;
+                isc_decode_timestamp(&ts, &t);
+                out += "TIMESTAMP ";
+                appendTime(out, t, ts.timestamp_time, true, true);
+            }
+            return true;
+    }
+
+    // Blobs can't be passed as literals and other types are not supported.
+    return false;
+}
+
+} // namespace anonymous
+
+void firebird_statement_backend::exchangeUseData(std::size_t row)
+{
+    for (std::size_t col = 0; col != uses_.size(); ++col)
+    {
+        static_cast<firebird_vector_use_type_backend*>(uses_[col])->exchangeData(row);
+    }
+}
+
+void firebird_statement_backend::executeRow()
+{
+    ISC_STATUS stat[stat_size];
+
+    XSQLDA * const t = sqlda2p_->sqld ? sqlda2p_ : NULL;
+    if (isc_dsql_execute(stat, session_.current_transaction(), &stmtp_, SQL_DIALECT_V6, t))
+    {
+        throw_iscerror(stat);
+    }
+
+    rowsAffectedBulk_ += getRowCount();
+}
+
+void firebird_statement_backend::executeBlocks(std::size_t rows)
+{
+    // Only the statements which can be used inside PSQL block and which don't
+    // return anything can be combined.
+    std::vector<std::string> parts;
+    bool useBlocks = sqldap_->sqld == 0 &&
+        (stmtType_ == isc_info_sql_stmt_insert ||
+         stmtType_ == isc_info_sql_stmt_update ||
+         stmtType_ == isc_info_sql_stmt_delete) &&
+        splitQuery(query_, static_cast<std::size_t>(sqlda2p_->sqld), parts);
+
+    // Output of the block is the total number of rows affected by it.
+    std::vector<char> outBuffer(XSQLDA_LENGTH(1));
+    XSQLDA * const out = reinterpret_cast<XSQLDA *>(&outBuffer[0]);
+    out->version = SQLDA_VERSION1;
+    out->sqln = 1;
+    out->sqld = 1;
+
+    ISC_INT64 blockCount = 0;
+    short blockCountInd = 0;
+    XSQLVAR * const outVar = out->sqlvar;
+    std::memset(outVar, 0, sizeof(XSQLVAR));
+    outVar->sqltype = SQL_INT64 + 1;
+    outVar->sqllen = sizeof(ISC_INT64);
+    outVar->sqldata = reinterpret_cast<char *>(&blockCount);
+    outVar->sqlind = &blockCountInd;
+
+    std::string const header("EXECUTE BLOCK RETURNS (soci_rows BIGINT) AS\n"
+                             "BEGIN\n"
+                             "soci_rows = 0;\n");
+    std::string const footer("END");
+
+    std::string block;
+    std::string statement;
+    std::size_t blockRows = 0;
+
+    for (std::size_t row = 0; row != rows || blockRows != 0; )
+    {
+        bool executeCurrent = false;
+        if (row != rows)
+        {
+            exchangeUseData(row);
+
+            // Format the statement for this row, if possible.
+            if (useBlocks)
+            {
+                statement = parts[0];
+                for (std::size_t i = 1; i != parts.size(); ++i)
+                {
+                    if (!appendLiteral(statement, sqlda2p_->sqlvar[i - 1]))
+                    {
+                        executeCurrent = true;
+                        break;
+                    }
+
+                    statement += parts[i];
+                }
+            }
+            else
+            {
+                executeCurrent = true;
+            }
+        }
+
+        // Add the statement to the current block if there is space for it.
+        bool const fits = !executeCurrent && row != rows &&
+            blockRows < maxBlockRows &&
+            header.size() + block.size() + statement.size() + footer.size()
+                + 64 < maxBlockLength;
+        if (!fits && blockRows == 0 && row != rows)
+        {
+            // The statement is too long to be put in a block on its own.
+            executeCurrent = true;
+        }
+
+        if (fits)
+        {
+            block += statement;
+            block += ";\nsoci_rows = soci_rows + ROW_COUNT;\n";
+            ++blockRows;
+            ++row;
+            continue;
+        }
+
+        // Otherwise execute the rows accumulated so far first to preserve the
+        // order of the rows.
+        if (blockRows != 0)
+        {
+            std::string const query = header + block + footer;
+
+            ISC_STATUS stat[stat_size];
+            if (isc_dsql_exec_immed2(stat, &session_.dbhp_,
+                    session_.current_transaction(),
+                    static_cast<unsigned short>(query.size()), query.c_str(),
+                    SQL_DIALECT_V6, NULL, out))
+            {
+                // The block may fail to compile even if its statements are
+                // valid, e.g. because it needs too many contexts. As it didn't
+                // change anything, execute its rows one by one instead: this
+                // either throws the real error or succeeds, in which case the
+                // blocks can't be used for this statement.
+                for (std::size_t r = row - blockRows; r != row; ++r)
+                {
+                    exchangeUseData(r);
+                    executeRow();
+                }
+
+                useBlocks = false;
+
+                // Restore the parameters of the current row, if any.
+                if (row != rows)
+                    exchangeUseData(row);
+            }
+            else
+            {
+                rowsAffectedBulk_ += blockCount;
+            }
+
+            block.clear();
+            blockRows = 0;
+
+            // The current row, if any, will be added to the next block.
+            if (!executeCurrent)
+                continue;
+        }
+
+        if (executeCurrent)
+        {
+            // Executing the block above didn't change the parameters buffers,
+            // which still contain the values of the current row.
+            executeRow();
+            ++row;
+        }
+    }
+}
+
+#if FB_API_VER >= 40
+
+namespace // anonymous
+{
+
+// Helpers releasing the Firebird interfaces when going out of scope.
+template <typename T>
+class fb_releaser
+{
+public:
+    fb_releaser() : p_(NULL) {}
+    ~fb_releaser() { if (p_) p_->release(); }
+
+    T * p_;
+
+private:
+    SOCI_NOT_COPYABLE(fb_releaser)
+};
+
+template <typename T>
+class fb_disposer
+{
+public:
+    fb_disposer() : p_(NULL) {}
+    ~fb_disposer() { if (p_) p_->dispose(); }
+
+    T * p_;
+
+private:
+    SOCI_NOT_COPYABLE(fb_disposer)
+};
+
+// Maximal size of the messages sent to the server by a single execution of
+// the batch, must be less than its default buffer size of 16MiB.
+std::size_t const maxBatchBytes = 8*1024*1024;
+
+// Execute one of the statements managing the savepoint used for undoing the
+// partially executed batches.
+void execute_savepoint_statement(firebird_session_backend & session,
+                                 char const * sql)
+{
+    ISC_STATUS stat[stat_size];
+    if (isc_dsql_execute_immediate(stat, &session.dbhp_,
+            session.current_transaction(), 0, sql, SQL_DIALECT_V6, NULL))
+    {
+        throw_iscerror(stat);
+    }
+}
+
+} // namespace anonymous
+
+bool firebird_statement_backend::executeBatch(std::size_t rows)
+{
+    using namespace Firebird;
+
+    if (!batchSupported_ || sqldap_->sqld != 0 || sqlda2p_->sqld == 0)
+    {
+        return false;
+    }
+
+    // Blobs would need to be registered with the batch, just don't use it.
+    for (short i = 0; i != sqlda2p_->sqld; ++i)
+    {
+        int const type = sqlda2p_->sqlvar[i].sqltype & ~1;
+        if (type == SQL_BLOB || type == SQL_ARRAY)
+            return false;
+    }
+
+    IMaster * const master = fb_get_master_interface();
+
+    fb_disposer<IStatus> statusHolder;
+    statusHolder.p_ = master->getStatus();
+    ThrowStatusWrapper status(statusHolder.p_);
+
+    fb_disposer<IStatus> errorStatus;
+    errorStatus.p_ = master->getStatus();
+
+    fb_releaser<IStatement> stmt;
+    fb_releaser<ITransaction> tra;
+    fb_releaser<IMessageMetadata> meta;
+    fb_disposer<IXpbBuilder> pb;
+    fb_releaser<IBatch> batch;
+
+    try
+    {
+        ISC_STATUS stat[stat_size];
+        if (fb_get_statement_interface(stat, &stmt.p_, &stmtp_) ||
+            fb_get_transaction_interface(stat, &tra.p_,
+                session_.current_transaction()))
+        {
+            throw_iscerror(stat);
+        }
+
+        // The messages are filled from the parameters buffers, so check that
+        // they have the expected layout.
+        meta.p_ = stmt.p_->getInputMetadata(&status);
+        for (short i = 0; i != sqlda2p_->sqld; ++i)
+        {
+            XSQLVAR const & var = sqlda2p_->sqlvar[i];
+            unsigned const n = static_cast<unsigned>(i);
+            if (meta.p_->getType(&status, n) != static_cast<unsigned>(var.sqltype & ~1) ||
+                meta.p_->getLength(&status, n) != static_cast<unsigned>(var.sqllen))
+            {
+                return false;
+            }
+        }
+
+        pb.p_ = master->getUtilInterface()->getXpbBuilder(&status,
+            IXpbBuilder::BATCH, NULL, 0);
+        pb.p_->insertInt(&status, IBatch::TAG_RECORD_COUNTS, 1);
+
+        try
+        {
+            batch.p_ = stmt.p_->createBatch(&status, meta.p_,
+                pb.p_->getBufferLength(&status), pb.p_->getBuffer(&status));
+        }
+        catch (FbException const &)
+        {
+            // The server doesn't support batches or they can't be used with
+            // this statement, don't try again.
+            batchSupported_ = false;
+            return false;
+        }
+
+        unsigned const alignedLength = meta.p_->getAlignedLength(&status);
+
+        std::size_t chunkRows = maxBatchBytes / alignedLength;
+        if (chunkRows == 0)
+            chunkRows = 1;
+
+        std::vector<unsigned char> messages;
+        for (std::size_t row = 0; row < rows; )
+        {
+            std::size_t const count = rows - row < chunkRows ? rows - row : chunkRows;
+            messages.assign(count * alignedLength, 0);
+
+            for (std::size_t n = 0; n != count; ++n, ++row)
+            {
+                exchangeUseData(row);
+
+                unsigned char * const msg = &messages[n * alignedLength];
+                for (short i = 0; i != sqlda2p_->sqld; ++i)
+                {
+                    XSQLVAR const & var = sqlda2p_->sqlvar[i];
+                    unsigned const col = static_cast<unsigned>(i);
+
+                    short const ind = var.sqlind != NULL && *var.sqlind == -1 ? -1 : 0;
+                    std::memcpy(msg + meta.p_->getNullOffset(&status, col),
+                        &ind, sizeof(ind));
+
+                    if (ind == 0)
+                    {
+                        std::size_t len = static_cast<std::size_t>(var.sqllen);
+                        if ((var.sqltype & ~1) == SQL_VARYING)
+                            len += sizeof(short);
+
+                        std::memcpy(msg + meta.p_->getOffset(&status, col),
+                            var.sqldata, len);
+                    }
+                }
+            }
+
+            batch.p_->add(&status, static_cast<unsigned>(count), &messages[0]);
+
+            // The execution stops at the first failed row, but the rows
+            // before it remain applied, so use a savepoint to undo them and
+            // apply either all the rows of this batch or none of them.
+            execute_savepoint_statement(session_, "SAVEPOINT SOCI_BATCH");
+
+            long long batchRowsAffected = 0;
+            try
+            {
+                // A single execution sends all the rows and returns the number
+                // of rows affected by each of them.
+                fb_disposer<IBatchCompletionState> cs;
+                cs.p_ = batch.p_->execute(&status, tra.p_);
+
+                unsigned const size = cs.p_->getSize(&status);
+                for (unsigned pos = 0; pos != size; ++pos)
+                {
+                    int const state = cs.p_->getState(&status, pos);
+                    if (state == IBatchCompletionState::EXECUTE_FAILED)
+                    {
+                        cs.p_->getStatus(&status, errorStatus.p_, pos);
+                        throw_iscerror(const_cast<ISC_STATUS *>(
+                            errorStatus.p_->getErrors()));
+                    }
+
+                    if (state > 0)
+                        batchRowsAffected += state;
+                }
+            }
+            catch (...)
+            {
+                try
+                {
+                    execute_savepoint_statement(session_,
+                        "ROLLBACK TO SAVEPOINT SOCI_BATCH");
+                }
+                catch (...)
+                {
+                    // Report the original error rather than this one.
+                }
+
+                throw;
+            }
+
+            execute_savepoint_statement(session_,
+                "RELEASE SAVEPOINT SOCI_BATCH ONLY");
+
+            rowsAffectedBulk_ += batchRowsAffected;
+        }
+    }
+    catch (FbException const & e)
+    {
+        throw_iscerror(const_cast<ISC_STATUS *>(e.getStatus()->getErrors()));
+    }
+
+    return true;
+}
+
+#else // FB_API_VER < 40
+
+bool firebird_statement_backend::executeBatch(std::size_t /* rows */)
+{
+    // IBatch interface is not available in this client library version.
+    return false;
+}
+
+#endif // FB_API_VER >= 40
@@ -19,7 +19,8 @@ using namespace soci::details::firebird;
 firebird_statement_backend::firebird_statement_backend(firebird_session_backend &session)
     : session_(session), stmtp_(0), sqldap_(NULL), sqlda2p_(NULL),
         boundByName_(false), boundByPos_(false), rowsFetched_(0), endOfRowSet_(false), rowsAffectedBulk_(-1LL),
-            intoType_(eStandard), useType_(eStandard), procedure_(false)
+            intoType_(eStandard), useType_(eStandard), procedure_(false),
+            stmtType_(0), batchSupported_(true)
 {}
 
 void firebird_statement_backend::prepareSQLDA(XSQLDA ** sqldap, short size)
@@ -234,6 +235,7 @@ void firebird_statement_backend::rewriteQuery(
 
     // get statement type
     int stType = statementType(tmpStmtp);
+    stmtType_ = stType;
 
     // free temporary prepared statement
     if (isc_dsql_free_statement(stat, &tmpStmtp, DSQL_drop))
@@ -308,6 +310,8 @@ void firebird_statement_backend::prepare(std::string const & query,
         throw_iscerror(stat);
     }
 
+    query_ = &queryBuffer[0];
+
     if (sqldap_->sqln < sqldap_->sqld)
     {
         // sqlda is too small for all columns. it must be reallocated
@@ -409,35 +413,16 @@ firebird_statement_backend::execute(int number)
 
     if (useType_ == eVector)
     {
-        long long rowsAffectedBulkTemp = 0;
-
-        // Here we have to explicitly loop to achieve the
-        // effect of inserting or updating with vector use elements.
+        // soci does not allow bulk insert/update and bulk select operations
+        // in same query. So here, we know that into elements are not
+        // vectors. So, there is no need to fetch data here.
         std::size_t rows = static_cast<firebird_vector_use_type_backend*>(uses_[0])->size();
-        for (std::size_t row=0; row < rows; ++row)
-        {
-            // first we have to prepare input parameters
-            for (std::size_t col=0; col<usize; ++col)
-            {
-                static_cast<firebird_vector_use_type_backend*>(uses_[col])->exchangeData(row);
-            }
 
-            // then execute query
-            if (isc_dsql_execute(stat, session_.current_transaction(), &stmtp_, SQL_DIALECT_V6, t))
-            {
-                // preserve the number of rows affected so far.
-                rowsAffectedBulk_ = rowsAffectedBulkTemp;
-                throw_iscerror(stat);
-            }
-            else
-            {
-                rowsAffectedBulkTemp += get_affected_rows();
-            }
-            // soci does not allow bulk insert/update and bulk select operations
-            // in same query. So here, we know that into elements are not
-            // vectors. So, there is no need to fetch data here.
+        rowsAffectedBulk_ = 0;
+        if (!executeBatch(rows))
+        {
+            executeBlocks(rows);
         }
-        rowsAffectedBulk_ = rowsAffectedBulkTemp;
     }
     else
     {
@@ -569,6 +554,11 @@ long long firebird_statement_backend::get_affected_rows()
         return rowsAffectedBulk_;
     }
 
+    return getRowCount();
+}
+
+long long firebird_statement_backend::getRowCount()
+{
     ISC_STATUS_ARRAY stat;
     char type_item[] = { isc_info_sql_records };
     char res_buffer[256];
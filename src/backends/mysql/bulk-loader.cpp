@@ -0,0 +1,388 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#define SOCI_MYSQL_SOURCE
+#include "soci/mysql/soci-mysql.h"
+#include "soci/session.h"
+#include "soci-dtocstr.h"
+#include "soci-vector-helpers.h"
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <sstream>
+
+using namespace soci;
+using namespace soci::details;
+
+namespace // anonymous
+{
+
+// The rows are formatted in chunks of at least this size, to avoid calling
+// the formatting code for every read() call done by MySQL.
+std::size_t const chunkSize = 64 * 1024;
+
+MYSQL * get_connection(session & sql)
+{
+    mysql_session_backend * const backend =
+        dynamic_cast<mysql_session_backend *>(sql.get_backend());
+    if (!backend)
+    {
+        throw soci_error("MySQL bulk loader can only be used with sessions "
+                         "connected using MySQL backend.");
+    }
+
+    return backend->conn_;
+}
+
+// Append the identifier quoted with backticks, doubling any embedded ones.
+void append_quoted_identifier(std::ostringstream & query,
+                              std::string const & name)
+{
+    query << '`';
+    for (std::string::const_iterator it = name.begin(); it != name.end(); ++it)
+    {
+        if (*it == '`')
+            query << '`';
+        query << *it;
+    }
+    query << '`';
+}
+
+// Append the table name, which may be qualified with the database name, and
+// so is quoted part by part.
+void append_quoted_table(std::ostringstream & query, std::string const & table)
+{
+    std::string::size_type const dot = table.find('.');
+    if (dot == std::string::npos)
+    {
+        append_quoted_identifier(query, table);
+        return;
+    }
+
+    append_quoted_identifier(query, table.substr(0, dot));
+    query << '.';
+    append_quoted_identifier(query, table.substr(dot + 1));
+}
+
+// Append the string escaped as required by "LOAD DATA" with the default
+// backslash escape character.
+void append_escaped(std::string & buf, char const * s, std::size_t len)
+{
+    for (std::size_t i = 0; i != len; ++i)
+    {
+        char const c = s[i];
+        switch (c)
+        {
+            case '\\': buf += "\\\\"; break;
+            case '\t': buf += "\\t"; break;
+            case '\n': buf += "\\n"; break;
+            case '\r': buf += "\\r"; break;
+            case '\0': buf += "\\0"; break;
+            default: buf += c; break;
+        }
+    }
+}
+
+template <typename T>
+void append_formatted(std::string & buf, char const * format, T value)
+{
+    char tmp[32];
+    int const len = snprintf(tmp, sizeof(tmp), format, value);
+    buf.append(tmp, static_cast<std::size_t>(len));
+}
+
+void append_value(std::string & buf,
+    mysql_bulk_loader::column_info const & col, std::size_t row)
+{
+    if (col.ind_ && (*col.ind_)[row] == i_null)
+    {
+        buf += "\\N";
+        return;
+    }
+
+    switch (col.type_)
+    {
+        case x_char:
+            append_escaped(buf,
+                &exchange_vector_type_cast<x_char>(col.data_)[row], 1);
+            break;
+
+        case x_stdstring:
+        case x_xmltype:
+        case x_longstring:
+            {
+                std::string const & s =
+                    vector_string_value(col.type_, col.data_, row);
+                append_escaped(buf, s.data(), s.length());
+            }
+            break;
+
+        case x_short:
+            append_formatted(buf, "%d", static_cast<int>(
+                exchange_vector_type_cast<x_short>(col.data_)[row]));
+            break;
+
+        case x_integer:
+            append_formatted(buf, "%d",
+                exchange_vector_type_cast<x_integer>(col.data_)[row]);
+            break;
+
+        case x_long_long:
+            append_formatted(buf, "%lld",
+                exchange_vector_type_cast<x_long_long>(col.data_)[row]);
+            break;
+
+        case x_unsigned_long_long:
+            append_formatted(buf, "%llu",
+                exchange_vector_type_cast<x_unsigned_long_long>(col.data_)[row]);
+            break;
+
+        case x_double:
+            buf += double_to_cstring(
+                exchange_vector_type_cast<x_double>(col.data_)[row]);
+            break;
+
+        case x_stdtm:
+            {
+                std::tm const & t =
+                    exchange_vector_type_cast<x_stdtm>(col.data_)[row];
+
+                char tmp[32];
+                int const len = snprintf(tmp, sizeof(tmp),
+                    "%04d-%02d-%02d %02d:%02d:%02d",
+                    t.tm_year + 1900, t.tm_mon + 1, t.tm_mday,
+                    t.tm_hour, t.tm_min, t.tm_sec);
+                buf.append(tmp, static_cast<std::size_t>(len));
+            }
+            break;
+
+        case x_statement:
+        case x_rowid:
+        case x_blob:
+            // Not supported, add_column() doesn't allow these types.
+            break;
+    }
+}
+
+// State of a single load, used as user data of the local infile callbacks.
+struct infile_reader
+{
+    infile_reader(std::vector<mysql_bulk_loader::column_info> const & columns,
+                  std::size_t rows)
+        : columns_(columns), rows_(rows), row_(0), offset_(0)
+    {
+    }
+
+    // Format the next rows into buf_, return false if there are no more.
+    bool format_rows()
+    {
+        buf_.clear();
+        offset_ = 0;
+
+        std::size_t const numColumns = columns_.size();
+        for (; row_ != rows_ && buf_.size() < chunkSize; ++row_)
+        {
+            for (std::size_t i = 0; i != numColumns; ++i)
+            {
+                if (i != 0)
+                    buf_ += '\t';
+
+                append_value(buf_, columns_[i], row_);
+            }
+
+            buf_ += '\n';
+        }
+
+        return !buf_.empty();
+    }
+
+    int read(char * out, unsigned int len)
+    {
+        unsigned int done = 0;
+        while (done != len)
+        {
+            if (offset_ == buf_.size() && !format_rows())
+                break;
+
+            std::size_t n = buf_.size() - offset_;
+            if (n > len - done)
+                n = len - done;
+
+            std::memcpy(out + done, buf_.data() + offset_, n);
+            offset_ += n;
+            done += static_cast<unsigned int>(n);
+        }
+
+        return static_cast<int>(done);
+    }
+
+    std::vector<mysql_bulk_loader::column_info> const & columns_;
+    std::size_t const rows_;
+    std::size_t row_;
+
+    std::string buf_;
+    std::size_t offset_;
+
+    // Error message if an exception was thrown by one of the callbacks.
+    std::string error_;
+};
+
+int infile_init(void ** ptr, char const * /* fileName */, void * data)
+{
+    *ptr = data;
+    return 0;
+}
+
+int infile_read(void * ptr, char * buf, unsigned int len)
+{
+    infile_reader * const reader = static_cast<infile_reader *>(ptr);
+
+    // Exceptions can't be propagated through MySQL code, so just remember
+    // the error and report it after the query fails.
+    try
+    {
+        return reader->read(buf, len);
+    }
+    catch (std::exception const & e)
+    {
+        reader->error_ = e.what();
+    }
+    catch (...)
+    {
+        reader->error_ = "unknown error";
+    }
+
+    return -1;
+}
+
+void infile_end(void * /* ptr */)
+{
+}
+
+int infile_error(void * ptr, char * msg, unsigned int len)
+{
+    infile_reader const * const reader = static_cast<infile_reader *>(ptr);
+
+    snprintf(msg, len, "%s", reader->error_.c_str());
+
+    return CR_UNKNOWN_ERROR;
+}
+
+} // namespace anonymous
+
+mysql_bulk_loader::mysql_bulk_loader(session & sql, std::string const & table)
+    : conn_(get_connection(sql)), table_(table), warnings_(0)
+{
+}
+
+void mysql_bulk_loader::add_column(std::string const & column, void * data,
+    exchange_type type, std::vector<indicator> const * ind)
+{
+    switch (type)
+    {
+        case x_char:
+        case x_stdstring:
+        case x_xmltype:
+        case x_longstring:
+        case x_short:
+        case x_integer:
+        case x_long_long:
+        case x_unsigned_long_long:
+        case x_double:
+        case x_stdtm:
+            break;
+
+        case x_statement:
+        case x_rowid:
+        case x_blob:
+            throw soci_error("Bulk loader column \"" + column +
+                             "\" used with non-supported type.");
+    }
+
+    column_info info;
+    info.name_ = column;
+    info.data_ = data;
+    info.type_ = type;
+    info.ind_ = ind;
+    columns_.push_back(info);
+}
+
+long long mysql_bulk_loader::load()
+{
+    if (columns_.empty())
+    {
+        throw soci_error("No columns to load.");
+    }
+
+    std::size_t const rows = get_vector_size(columns_[0].type_,
+                                             columns_[0].data_);
+    for (std::size_t i = 0; i != columns_.size(); ++i)
+    {
+        column_info const & col = columns_[i];
+        if (get_vector_size(col.type_, col.data_) != rows)
+        {
+            throw soci_error("Bulk loader column \"" + col.name_ +
+                             "\" has a different number of values.");
+        }
+
+        if (col.ind_ && col.ind_->size() != rows)
+        {
+            throw soci_error("Bulk loader column \"" + col.name_ +
+                             "\" has a different number of indicators.");
+        }
+    }
+
+    warnings_ = 0;
+    if (rows == 0)
+    {
+        return 0;
+    }
+
+    // Use hexadecimal literals for the separators to avoid depending on
+    // NO_BACKSLASH_ESCAPES SQL mode and the same character set as used for
+    // the parameters of the normal statements. The file name is not used.
+    std::ostringstream query;
+    query << "LOAD DATA LOCAL INFILE 'soci' INTO TABLE ";
+    append_quoted_table(query, table_);
+    query << " CHARACTER SET " << mysql_character_set_name(conn_)
+          << " FIELDS TERMINATED BY X'09' ESCAPED BY X'5C'"
+          << " LINES TERMINATED BY X'0A' (";
+    for (std::size_t i = 0; i != columns_.size(); ++i)
+    {
+        if (i != 0)
+            query << ", ";
+        append_quoted_identifier(query, columns_[i].name_);
+    }
+    query << ")";
+
+    std::string const queryStr = query.str();
+
+    infile_reader reader(columns_, rows);
+    mysql_set_local_infile_handler(conn_,
+        infile_init, infile_read, infile_end, infile_error,
+        &reader);
+
+    int const rc = mysql_real_query(conn_, queryStr.c_str(),
+        static_cast<unsigned long>(queryStr.size()));
+
+    mysql_set_local_infile_default(conn_);
+
+    if (rc != 0)
+    {
+        if (!reader.error_.empty())
+        {
+            throw soci_error("Bulk load failed: " + reader.error_);
+        }
+
+        throw mysql_soci_error(std::string("Bulk load failed - ") + mysql_error(conn_),
+            mysql_errno(conn_));
+    }
+
+    warnings_ = mysql_warning_count(conn_);
+
+    return static_cast<long long>(mysql_affected_rows(conn_));
+}
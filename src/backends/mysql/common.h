@@ -10,10 +10,12 @@
 
 #include "soci/mysql/soci-mysql.h"
 #include "soci-cstrtod.h"
+#include "soci-cstrtoi.h"
 #include "soci-compiler.h"
 // std
 #include <cstddef>
 #include <ctime>
+#include <limits>
 #include <locale>
 #include <sstream>
 #include <vector>
@@ -70,6 +72,47 @@ void parse_num(char const *buf, double &x)
     }
 }
 
+// Convert a non-integer number, e.g. a DECIMAL or DOUBLE value, returned by
+// the text protocol to an integer by truncating it, as the binary protocol
+// used by the prepared statements does, but only if it is in range.
+template <typename T>
+void parse_truncated_integer(char const *buf, T &x)
+{
+    double d;
+    parse_num(buf, d);
+
+    // Both bounds are powers of 2 and so are represented exactly.
+    double const lo = static_cast<double>((std::numeric_limits<T>::min)());
+    double const hi =
+        2.0 * static_cast<double>((std::numeric_limits<T>::max)() / 2 + 1);
+    if (d < lo || d >= hi)
+    {
+        throw soci_error(std::string("Cannot convert data: value \"") + buf +
+                         "\" is out of range.");
+    }
+
+    x = static_cast<T>(d);
+}
+
+// Helpers for parsing the integer values returned by the text protocol.
+template <typename T>
+void parse_integer(char const *buf, T &x)
+{
+    if (!cstring_to_integer(x, buf))
+    {
+        parse_truncated_integer(buf, x);
+    }
+}
+
+template <typename T>
+void parse_unsigned(char const *buf, T &x)
+{
+    if (!cstring_to_unsigned(x, buf))
+    {
+        parse_truncated_integer(buf, x);
+    }
+}
+
 // helper for escaping strings
 char * quote(MYSQL * conn, const char *s, size_t len);
 
@@ -16,8 +16,13 @@
 #include <climits>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <string>
 
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
 #ifdef _MSC_VER
 #pragma warning(disable:4355)
 #endif
@@ -30,6 +35,39 @@ using std::string;
 namespace
 { // anonymous
 
+// Thread id is read by cancel(), which can be called from any thread, so it
+// is only accessed using atomic operations.
+#if defined(__GNUC__)
+
+inline unsigned long load_thread_id(unsigned long const * p)
+{
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+inline void store_thread_id(unsigned long * p, unsigned long value)
+{
+    __atomic_store_n(p, value, __ATOMIC_RELEASE);
+}
+
+#elif defined(_WIN32)
+
+inline unsigned long load_thread_id(unsigned long const * p)
+{
+    return static_cast<unsigned long>(InterlockedCompareExchange(
+        reinterpret_cast<LONG volatile *>(const_cast<unsigned long *>(p)),
+        0, 0));
+}
+
+inline void store_thread_id(unsigned long * p, unsigned long value)
+{
+    InterlockedExchange(reinterpret_cast<LONG volatile *>(p),
+        static_cast<LONG>(value));
+}
+
+#else
+#error "Atomic operations are not implemented for this compiler."
+#endif
+
 void skip_white(std::string::const_iterator *i,
     std::string::const_iterator const & end, bool endok)
 {
@@ -173,7 +211,8 @@ void parse_connect_string(const string & connectString,
     string *charset, bool *charset_p, bool *reconnect_p,
     unsigned int *connect_timeout, bool *connect_timeout_p,
     unsigned int *read_timeout, bool *read_timeout_p,
-    unsigned int *write_timeout, bool *write_timeout_p)
+    unsigned int *write_timeout, bool *write_timeout_p,
+    mysql_result_mode *result_mode, bool *result_mode_p)
 {
     *host_p = false;
     *user_p = false;
@@ -190,6 +229,7 @@ void parse_connect_string(const string & connectString,
     *connect_timeout_p = false;
     *read_timeout_p = false;
     *write_timeout_p = false;
+    *result_mode_p = false;
     string err = "Malformed connection string.";
     string::const_iterator i = connectString.begin(),
         end = connectString.end();
@@ -308,6 +348,19 @@ void parse_connect_string(const string & connectString,
             char *endp;
             *write_timeout = std::strtoul(val.c_str(), &endp, 10);
             *write_timeout_p = true;
+        } else if (par == "result_mode" && !*result_mode_p)
+        {
+            if (val == "cursor")
+                *result_mode = mysql_result_cursor;
+            else if (val == "buffered")
+                *result_mode = mysql_result_buffered;
+            else if (val == "unbuffered")
+                *result_mode = mysql_result_unbuffered;
+            else
+                throw soci_error("\"result_mode\" option must be one of "
+                                 "\"cursor\", \"buffered\" or \"unbuffered\"");
+
+            *result_mode_p = true;
         }
         else
         {
@@ -330,90 +383,93 @@ void parse_connect_string(const string & connectString,
 #endif
 
 
-mysql_session_backend::mysql_session_backend(
-    connection_parameters const & parameters)
+namespace // anonymous
 {
+
+// Set the options specified in the connect string and open the connection.
+//
+// If resultMode is NULL, the connection is only used internally for a single
+// query and the options only affecting the session, such as "reconnect",
+// "local_infile" or "result_mode", are ignored.
+void do_connect(MYSQL *conn, std::string const & connectString,
+    mysql_result_mode *resultMode)
+{
+    bool const isSession = resultMode != NULL;
+    mysql_result_mode resultModeUnused;
+    if (!isSession)
+        resultMode = &resultModeUnused;
+
     string host, user, password, db, unix_socket, ssl_ca, ssl_cert, ssl_key,
         charset;
     int port, local_infile;
     unsigned int connect_timeout, read_timeout, write_timeout;
     bool host_p, user_p, password_p, db_p, unix_socket_p, port_p,
         ssl_ca_p, ssl_cert_p, ssl_key_p, local_infile_p, charset_p, reconnect_p,
-        connect_timeout_p, read_timeout_p, write_timeout_p;
-    parse_connect_string(parameters.get_connect_string(), &host, &host_p, &user, &user_p,
+        connect_timeout_p, read_timeout_p, write_timeout_p, result_mode_p;
+    parse_connect_string(connectString, &host, &host_p, &user, &user_p,
         &password, &password_p, &db, &db_p,
         &unix_socket, &unix_socket_p, &port, &port_p,
         &ssl_ca, &ssl_ca_p, &ssl_cert, &ssl_cert_p, &ssl_key, &ssl_key_p,
         &local_infile, &local_infile_p, &charset, &charset_p, &reconnect_p,
         &connect_timeout, &connect_timeout_p,
         &read_timeout, &read_timeout_p,
-        &write_timeout, &write_timeout_p);
-    conn_ = mysql_init(NULL);
-    if (conn_ == NULL)
-    {
-        throw soci_error("mysql_init() failed.");
-    }
-    if (reconnect_p)
+        &write_timeout, &write_timeout_p,
+        resultMode, &result_mode_p);
+    if (reconnect_p && isSession)
     {
         #if MYSQL_VERSION_ID < 8
             my_bool reconnect = 1;
         #else
             bool reconnect = 1;
         #endif
-        if (0 != mysql_options(conn_, MYSQL_OPT_RECONNECT, &reconnect))
+        if (0 != mysql_options(conn, MYSQL_OPT_RECONNECT, &reconnect))
         {
-            clean_up();
             throw soci_error("mysql_options(MYSQL_OPT_RECONNECT) failed.");
         }
     }
     if (charset_p)
     {
-        if (0 != mysql_options(conn_, MYSQL_SET_CHARSET_NAME, charset.c_str()))
+        if (0 != mysql_options(conn, MYSQL_SET_CHARSET_NAME, charset.c_str()))
         {
-            clean_up();
             throw soci_error("mysql_options(MYSQL_SET_CHARSET_NAME) failed.");
         }
     }
     if (ssl_ca_p)
     {
-        mysql_ssl_set(conn_, ssl_key_p ? ssl_key.c_str() : NULL,
+        mysql_ssl_set(conn, ssl_key_p ? ssl_key.c_str() : NULL,
                       ssl_cert_p ? ssl_cert.c_str() : NULL,
                       ssl_ca.c_str(), 0, 0);
     }
-    if (local_infile_p && local_infile == 1)
+    if (local_infile_p && local_infile == 1 && isSession)
     {
-        if (0 != mysql_options(conn_, MYSQL_OPT_LOCAL_INFILE, NULL))
+        if (0 != mysql_options(conn, MYSQL_OPT_LOCAL_INFILE, NULL))
         {
-            clean_up();
             throw soci_error(
                 "mysql_options() failed when trying to set local-infile.");
         }
     }
     if (connect_timeout_p)
     {
-        if (0 != mysql_options(conn_, MYSQL_OPT_CONNECT_TIMEOUT, &connect_timeout))
+        if (0 != mysql_options(conn, MYSQL_OPT_CONNECT_TIMEOUT, &connect_timeout))
         {
-            clean_up();
             throw soci_error("mysql_options(MYSQL_OPT_CONNECT_TIMEOUT) failed.");
         }
     }
     if (read_timeout_p)
     {
-        if (0 != mysql_options(conn_, MYSQL_OPT_READ_TIMEOUT, &read_timeout))
+        if (0 != mysql_options(conn, MYSQL_OPT_READ_TIMEOUT, &read_timeout))
         {
-            clean_up();
             throw soci_error("mysql_options(MYSQL_OPT_READ_TIMEOUT) failed.");
         }
     }
     if (write_timeout_p)
     {
-        if (0 != mysql_options(conn_, MYSQL_OPT_WRITE_TIMEOUT, &write_timeout))
+        if (0 != mysql_options(conn, MYSQL_OPT_WRITE_TIMEOUT, &write_timeout))
         {
-            clean_up();
             throw soci_error("mysql_options(MYSQL_OPT_WRITE_TIMEOUT) failed.");
         }
     }
-    if (mysql_real_connect(conn_,
+    if (mysql_real_connect(conn,
             host_p ? host.c_str() : NULL,
             user_p ? user.c_str() : NULL,
             password_p ? password.c_str() : NULL,
@@ -426,13 +482,39 @@ mysql_session_backend::mysql_session_backend(
             CLIENT_FOUND_ROWS) == NULL)
 #endif
     {
-        string errMsg = mysql_error(conn_);
-        unsigned int errNum = mysql_errno(conn_);
-        clean_up();
+        string errMsg = mysql_error(conn);
+        unsigned int errNum = mysql_errno(conn);
         throw mysql_soci_error(errMsg, errNum);
     }
 }
 
+} // namespace anonymous
+
+mysql_session_backend::mysql_session_backend(
+    connection_parameters const & parameters)
+    : resultMode_(mysql_result_cursor),
+      connectString_(parameters.get_connect_string()),
+      threadId_(0), statementTimeout_(0)
+{
+    conn_ = mysql_init(NULL);
+    if (conn_ == NULL)
+    {
+        throw soci_error("mysql_init() failed.");
+    }
+
+    try
+    {
+        do_connect(conn_, connectString_, &resultMode_);
+    }
+    catch (...)
+    {
+        clean_up();
+        throw;
+    }
+
+    store_thread_id(&threadId_, mysql_thread_id(conn_));
+}
+
 #if defined(__GNUC__) && ( __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6)))
 #pragma GCC diagnostic pop
 #endif
@@ -472,6 +554,84 @@ bool mysql_session_backend::is_connected()
     return mysql_ping(conn_) == 0;
 }
 
+void mysql_session_backend::cancel()
+{
+    // The connection executing the query can't be used while it's busy, and
+    // MySQL doesn't provide any other way of cancelling it, so open a new one
+    // just for killing the query.
+    MYSQL *conn = mysql_init(NULL);
+    if (conn == NULL)
+    {
+        throw soci_error("mysql_init() failed.");
+    }
+
+    try
+    {
+        do_connect(conn, connectString_, NULL);
+
+        char query[64];
+        snprintf(query, sizeof(query), "KILL QUERY %lu", load_thread_id(&threadId_));
+        hard_exec(conn, query);
+    }
+    catch (...)
+    {
+        // Don't call mysql_library_end() here, unlike in clean_up(), as the
+        // library is still used by this session.
+        mysql_close(conn);
+        throw;
+    }
+
+    mysql_close(conn);
+}
+
+void mysql_session_backend::update_thread_id()
+{
+    unsigned long const threadId = mysql_thread_id(conn_);
+    if (threadId == load_thread_id(&threadId_))
+    {
+        return;
+    }
+
+    // The new connection uses the default timeout too.
+    statementTimeout_ = 0;
+
+    store_thread_id(&threadId_, threadId);
+}
+
+void mysql_session_backend::set_statement_timeout(int milliseconds)
+{
+    if (milliseconds == statementTimeout_)
+    {
+        return;
+    }
+
+    // MariaDB uses a different variable with the value in seconds.
+    char query[64];
+    if (std::strstr(mysql_get_server_info(conn_), "MariaDB"))
+    {
+        if (milliseconds)
+            snprintf(query, sizeof(query),
+                     "SET SESSION max_statement_time = %d.%03d",
+                     milliseconds / 1000, milliseconds % 1000);
+        else
+            snprintf(query, sizeof(query),
+                     "SET SESSION max_statement_time = DEFAULT");
+    }
+    else
+    {
+        if (milliseconds)
+            snprintf(query, sizeof(query),
+                     "SET SESSION max_execution_time = %d", milliseconds);
+        else
+            snprintf(query, sizeof(query),
+                     "SET SESSION max_execution_time = DEFAULT");
+    }
+
+    hard_exec(conn_, query);
+
+    statementTimeout_ = milliseconds;
+}
+
 void mysql_session_backend::begin()
 {
     hard_exec(conn_, "BEGIN");
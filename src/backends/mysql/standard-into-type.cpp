@@ -8,6 +8,7 @@
 #define SOCI_MYSQL_SOURCE
 #include "soci/soci-platform.h"
 #include "soci/mysql/soci-mysql.h"
+#include "common.h"
 #include "soci-compiler.h"
 #include "soci-cstrtoi.h"
 #include "soci-exchange-cast.h"
@@ -37,17 +38,15 @@ void mysql_standard_into_type_backend::define_by_pos(
     case x_longstring:
     case x_xmltype:
         mysqlType_ = MYSQL_TYPE_STRING;
-        // For LONGVARCHAR fields the returned size is ODBC_MAX_COL_SIZE
-        // (or 0 for some backends), but this doesn't correspond to the actual
-        // field size, which can be (much) greater. For now we just used
-        // a buffer of huge (100MiB) hardcoded size, which is clearly not
-        // ideal, but changing this would require using SQLGetData() and is
-        // not trivial, so for now we're stuck with this suboptimal solution.
-        size = statement_.column_size(position_);
-        size++;
-        buf_ = new char[size];
-        data = buf_;
-        break;
+
+        // Determining the buffer size requires preparing the statement,
+        // which is not done for the one-time queries executed using the text
+        // protocol, so postpone it until pre_fetch() for them.
+        if (!statement_.oneTimeQuery_)
+        {
+            bind_string_buffer();
+        }
+        return;
     case x_short:
         mysqlType_ = MYSQL_TYPE_SHORT;
         size = sizeof(short);
@@ -75,6 +74,27 @@ void mysql_standard_into_type_backend::define_by_pos(
         throw soci_error("Into element used with non-supported type.");
     }
 
+    bind_result(data, size);
+}
+
+void mysql_standard_into_type_backend::bind_string_buffer()
+{
+    // For LONGVARCHAR fields the returned size is ODBC_MAX_COL_SIZE
+    // (or 0 for some backends), but this doesn't correspond to the actual
+    // field size, which can be (much) greater. For now we just used
+    // a buffer of huge (100MiB) hardcoded size, which is clearly not
+    // ideal, but changing this would require using SQLGetData() and is
+    // not trivial, so for now we're stuck with this suboptimal solution.
+    unsigned long const size =
+        static_cast<unsigned long>(statement_.column_size(position_)) + 1;
+    buf_ = new char[size];
+
+    bind_result(buf_, size);
+}
+
+void mysql_standard_into_type_backend::bind_result(void* data,
+    unsigned long size)
+{
     valueLen_ = 0;
     memset(&bindingInfo_, 0, sizeof(MYSQL_BIND));
     bindingInfo_.buffer_type = mysqlType_;
@@ -84,12 +104,25 @@ void mysql_standard_into_type_backend::define_by_pos(
     bindingInfo_.error = &isError_;
     bindingInfo_.is_unsigned = (type_ == x_unsigned_long_long);
 
-    statement_.addResultBinding(&bindingInfo_);
+    statement_.setResultBinding(position_, bindingInfo_);
 }
 
 void mysql_standard_into_type_backend::pre_fetch()
 {
-    //...
+    switch (type_)
+    {
+    case x_stdstring:
+    case x_longstring:
+    case x_xmltype:
+        if (buf_ == NULL && !statement_.use_text_protocol())
+        {
+            bind_string_buffer();
+        }
+        break;
+
+    default:
+        break;
+    }
 }
 
 void mysql_standard_into_type_backend::post_fetch(
@@ -104,6 +137,12 @@ void mysql_standard_into_type_backend::post_fetch(
 
     if (gotData)
     {
+        if (statement_.textRow_ != NULL)
+        {
+            post_fetch_text(ind);
+            return;
+        }
+
         // first, deal with indicators
         if (*bindingInfo_.is_null)
         {
@@ -156,6 +195,73 @@ void mysql_standard_into_type_backend::post_fetch(
     }
 }
 
+void mysql_standard_into_type_backend::post_fetch_text(indicator * ind)
+{
+    MYSQL_RES* const result = statement_.result_;
+    if (static_cast<unsigned int>(position_) > mysql_num_fields(result))
+    {
+        throw soci_error("Into element position is out of range.");
+    }
+
+    char const* const buf = statement_.textRow_[position_ - 1];
+    if (buf == NULL)
+    {
+        if (ind == NULL)
+        {
+            throw soci_error(
+                "Null value fetched and no indicator defined.");
+        }
+
+        *ind = i_null;
+        return;
+    }
+
+    if (ind != NULL)
+    {
+        *ind = i_ok;
+    }
+
+    unsigned long const len = statement_.textLengths_[position_ - 1];
+
+    switch (type_)
+    {
+    case x_char:
+        exchange_type_cast<x_char>(data_) = buf[0];
+        break;
+    case x_stdstring:
+        exchange_type_cast<x_stdstring>(data_).assign(buf, len);
+        break;
+    case x_longstring:
+        exchange_type_cast<x_longstring>(data_).value.assign(buf, len);
+        break;
+    case x_xmltype:
+        exchange_type_cast<x_xmltype>(data_).value.assign(buf, len);
+        break;
+    case x_short:
+        mysql::parse_integer(buf, exchange_type_cast<x_short>(data_));
+        break;
+    case x_integer:
+        mysql::parse_integer(buf, exchange_type_cast<x_integer>(data_));
+        break;
+    case x_long_long:
+        mysql::parse_integer(buf, exchange_type_cast<x_long_long>(data_));
+        break;
+    case x_unsigned_long_long:
+        mysql::parse_unsigned(buf,
+            exchange_type_cast<x_unsigned_long_long>(data_));
+        break;
+    case x_double:
+        mysql::parse_num(buf, exchange_type_cast<x_double>(data_));
+        break;
+    case x_stdtm:
+        parse_std_tm(buf, exchange_type_cast<x_stdtm>(data_));
+        break;
+    default:
+        // Other types are rejected by define_by_pos().
+        break;
+    }
+}
+
 void mysql_standard_into_type_backend::clean_up()
 {
     if (buf_)
@@ -20,6 +20,10 @@ using namespace soci::details;
 void* mysql_standard_use_type_backend::prepare_for_bind(
     unsigned long &size, enum_field_types &sqlType)
 {
+    // Note that the values are never copied into temporary buffers but used
+    // directly, so that the binding only changes if the address of the data
+    // does, e.g. when a string is reallocated, and mysql_stmt_bind_param()
+    // doesn't need to be called again for each execution of the statement.
     switch (type_)
     {
     // simple cases
@@ -44,69 +48,58 @@ void* mysql_standard_use_type_backend::prepare_for_bind(
     case x_char:
         sqlType = MYSQL_TYPE_STRING;
         size = 1;
-        buf_ = new char[size];
-        buf_[0] = exchange_type_cast<x_char>(data_);
         break;
     case x_stdstring:
-    {
-        std::string const& s = exchange_type_cast<x_stdstring>(data_);
-
-        copy_from_string(s, size, sqlType);
-    }
-    break;
+        return bind_string(exchange_type_cast<x_stdstring>(data_),
+                           size, sqlType);
     case x_stdtm:
     {
         std::tm const& t = exchange_type_cast<x_stdtm>(data_);
 
         sqlType = MYSQL_TYPE_DATETIME;
-        
-        buf_ = new char[sizeof(MYSQL_TIME)];
-        memset(buf_, 0, sizeof(MYSQL_TIME));
 
         // From example https://dev.mysql.com/doc/c-api/5.6/en/c-api-prepared-statement-date-handling.html
         // length is zero
         size = 0;
 
-        MYSQL_TIME* ts = reinterpret_cast<MYSQL_TIME*>(buf_);
+        memset(&time_, 0, sizeof(MYSQL_TIME));
+        time_.year = static_cast<unsigned int>(t.tm_year + 1900);
+        time_.month = static_cast<unsigned int>(t.tm_mon + 1);
+        time_.day = static_cast<unsigned int>(t.tm_mday);
+        time_.hour = static_cast<unsigned int>(t.tm_hour);
+        time_.minute = static_cast<unsigned int>(t.tm_min);
+        time_.second = static_cast<unsigned int>(t.tm_sec);
 
-        ts->year = static_cast<unsigned int>(t.tm_year + 1900);
-        ts->month = static_cast<unsigned int>(t.tm_mon + 1);
-        ts->day = static_cast<unsigned int>(t.tm_mday);
-        ts->hour = static_cast<unsigned int>(t.tm_hour);
-        ts->minute = static_cast<unsigned int>(t.tm_min);
-        ts->second = static_cast<unsigned int>(t.tm_sec);
+        return &time_;
     }
-    break;
 
     case x_longstring:
-        copy_from_string(exchange_type_cast<x_longstring>(data_).value,
-                         size, sqlType);
-        break;
+        return bind_string(exchange_type_cast<x_longstring>(data_).value,
+                           size, sqlType);
     case x_xmltype:
-        copy_from_string(exchange_type_cast<x_xmltype>(data_).value,
-                         size, sqlType);
-        break;
+        return bind_string(exchange_type_cast<x_xmltype>(data_).value,
+                           size, sqlType);
 
     // unsupported types
     default:
         throw soci_error("Use element used with non-supported type.");
     }
 
-    // Return either the pointer to C++ data itself or the buffer that we
-    // allocated, if any.
-    return buf_ ? buf_ : data_;
+    return data_;
 }
 
-void mysql_standard_use_type_backend::copy_from_string(
+void* mysql_standard_use_type_backend::bind_string(
     std::string const& s,
     unsigned long& size,
     enum_field_types& sqlType)
 {
-    size = s.size();
+    size = static_cast<unsigned long>(s.size());
     sqlType = MYSQL_TYPE_STRING;
-    buf_ = new char[size];
-    memcpy(buf_, s.c_str(), size);
     indHolder_ = STMT_INDICATOR_NONE;
+
+    // MySQL never modifies the parameter buffers, so it's safe to cast away
+    // constness here.
+    return const_cast<char*>(s.data());
 }
 
 void mysql_standard_use_type_backend::bind_by_pos(
@@ -166,38 +159,23 @@ void mysql_standard_use_type_backend::pre_use(indicator const *ind)
 {
     // first deal with data
     enum_field_types sqlType;
- 
+
     void* const sqlData = prepare_for_bind(size_, sqlType);
 
-    // If the indicator is i_null, we need to pass the corresponding value to
-    // the ODBC function, and we have to do it without changing indHolder_
-    // itself because we may need to use its original value again when we're
-    // called the next when executing a prepared statement multiple times.
-    //
-    // So use separate holder variables depending on whether we need to insert
-    // null or not.
-    static char indHolderNull = STMT_INDICATOR_NULL;
-    static my_bool myBoolTrue = true;
-    static my_bool myBoolFalse = false;
+    // The value of isnull_ is used when executing the statement, so the
+    // binding itself doesn't change when the indicator does.
+    isnull_ = ind != NULL && *ind == i_null;
 
     memset(&bindingInfo_, 0, sizeof(MYSQL_BIND));
 
-    bindingInfo_.buffer = (char*)sqlData;
+    bindingInfo_.buffer = sqlData;
     bindingInfo_.buffer_length = size_;
     bindingInfo_.buffer_type = sqlType;
     bindingInfo_.length = &size_;
+    bindingInfo_.is_null = &isnull_;
     bindingInfo_.is_unsigned = (type_ == x_unsigned_long_long);
 
-    if (ind != NULL && *ind == i_null)
-    {
-        bindingInfo_.is_null = &myBoolTrue;
-    }    
-
-//    bindingInfo_.u.indicator = ind && *ind == i_null ? : reinterpret_cast<char*>(&indHolder_);
-
-    statement_.addParameterBinding(&bindingInfo_);
-
-   
+    statement_.setParameterBinding(position_, bindingInfo_);
 }
 
 void mysql_standard_use_type_backend::post_use(bool gotData, indicator *ind)
@@ -226,10 +204,5 @@ void mysql_standard_use_type_backend::post_use(bool gotData, indicator *ind)
 
 void mysql_standard_use_type_backend::clean_up()
 {
-    if (buf_ != NULL)
-    {
-        delete [] buf_;
-        buf_ = NULL;
-    }
+    // Nothing to do, no buffers are allocated by this element.
 }
-
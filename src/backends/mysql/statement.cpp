@@ -21,10 +21,35 @@ mysql_statement_backend::mysql_statement_backend(mysql_session_backend& session)
     hasIntoElements_(false), hasVectorIntoElements_(false), hasUseElements_(false), 
     hasVectorUseElements_(false), vectorUseElementCount_(0), vectorIntoElementCount_(0),
     numRowsFetched_(0), rowsAffected_(-1LL), fetchVectorByRows_(false),
-    boundByName_(false), boundByPos_(false), metadata_(NULL)
+    boundByName_(false), boundByPos_(false), metadata_(NULL),
+    oneTimeQuery_(false), prepared_(false), textRow_(NULL), textLengths_(NULL),
+    parameterBindingsChanged_(false), resultBindingsChanged_(false),
+    boundArraySize_(0), resultMode_(session.resultMode_), timeout_(0)
 {
 }
 
+void mysql_statement_backend::setBinding(std::vector<MYSQL_BIND>& bindings,
+    int position, MYSQL_BIND const& bindingInfo, bool& changed)
+{
+    std::size_t const index = static_cast<std::size_t>(position - 1);
+    if (index >= bindings.size())
+    {
+        MYSQL_BIND empty;
+        memset(&empty, 0, sizeof(MYSQL_BIND));
+        bindings.resize(index + 1, empty);
+        changed = true;
+    }
+
+    // The bindings are always zeroed before being filled, so comparing them
+    // bytewise is fine.
+    MYSQL_BIND& binding = bindings[index];
+    if (memcmp(&binding, &bindingInfo, sizeof(MYSQL_BIND)) != 0)
+    {
+        memcpy(&binding, &bindingInfo, sizeof(MYSQL_BIND));
+        changed = true;
+    }
+}
+
 void mysql_statement_backend::alloc()
 {
 
@@ -41,12 +66,22 @@ void mysql_statement_backend::alloc()
 void mysql_statement_backend::clean_up()
 {
     rowsAffected_ = -1LL;
+    free_text_result();
     mysql_stmt_close(hstmt_);
 }
 
 void mysql_statement_backend::prepare(std::string const & query,
-    statement_type /* eType */)
+    statement_type eType)
 {
+    // One-time queries may be executed using the text protocol, so don't
+    // prepare them right now.
+    oneTimeQuery_ = eType == st_one_time_query;
+    prepared_ = false;
+    if (oneTimeQuery_)
+    {
+        originalQuery_ = query;
+    }
+
     // rewrite the query by transforming all named parameters into
     // the Mysql ? s
 
@@ -124,6 +159,28 @@ void mysql_statement_backend::prepare(std::string const & query,
         names_.push_back(name);
         query_ += "?";
     }
+
+    if (!oneTimeQuery_)
+    {
+        ensure_prepared();
+    }
+
+    // reset any old into buffers and bindings, they will be added later if
+    // they're used with this query
+    intos_.clear();
+    parameterBindings_.clear();
+    resultBindings_.clear();
+    parameterBindingsChanged_ = false;
+    resultBindingsChanged_ = false;
+}
+
+void mysql_statement_backend::ensure_prepared()
+{
+    if (prepared_)
+    {
+        return;
+    }
+
     if (mysql_stmt_prepare(hstmt_, query_.c_str(), static_cast<unsigned long>(query_.size())) != 0)
     {
         std::ostringstream ss;
@@ -131,17 +188,112 @@ void mysql_statement_backend::prepare(std::string const & query,
         throw mysql_soci_error(ss.str() + " -" + mysql_stmt_error(hstmt_), mysql_stmt_errno(hstmt_));
     }
 
+    prepared_ = true;
+}
 
-    // reset any old into buffers, they will be added later if they're used
-    // with this query
-    intos_.clear();
+bool mysql_statement_backend::use_text_protocol() const
+{
+    return oneTimeQuery_ && !prepared_ &&
+        !hasUseElements_ && !hasVectorUseElements_ && !hasVectorIntoElements_;
+}
+
+void mysql_statement_backend::free_text_result()
+{
+    if (result_ != NULL)
+    {
+        mysql_free_result(result_);
+        result_ = NULL;
+    }
+
+    textRow_ = NULL;
+    textLengths_ = NULL;
+}
+
+statement_backend::exec_fetch_result
+mysql_statement_backend::execute_text(int number)
+{
+    MYSQL* const conn = session_.conn_;
+
+    if (mysql_real_query(conn, originalQuery_.c_str(),
+            static_cast<unsigned long>(originalQuery_.size())) != 0)
+    {
+        throw mysql_soci_error(std::string("Statement execute failed - ") + mysql_error(conn),
+            mysql_errno(conn));
+    }
+
+    // The result is always stored on the client, as only a single row is
+    // fetched from it anyhow, and this allows to discard any other results,
+    // which may be returned by stored procedures, immediately.
+    result_ = mysql_store_result(conn);
+    if (result_ == NULL && mysql_field_count(conn) != 0)
+    {
+        throw mysql_soci_error(std::string("Error storing the result - ") + mysql_error(conn),
+            mysql_errno(conn));
+    }
+
+    rowsAffected_ = static_cast<long long>(mysql_affected_rows(conn));
+
+    for (;;)
+    {
+        int const rc = mysql_next_result(conn);
+        if (rc == -1)
+        {
+            break;
+        }
+
+        if (rc != 0)
+        {
+            throw mysql_soci_error(std::string("Error retrieving the next result - ") + mysql_error(conn),
+                mysql_errno(conn));
+        }
+
+        if (MYSQL_RES* const other = mysql_store_result(conn))
+        {
+            mysql_free_result(other);
+        }
+    }
+
+    if (number > 0 && result_ != NULL)
+    {
+        return fetch_text();
+    }
+
+    return ef_success;
+}
+
+statement_backend::exec_fetch_result
+mysql_statement_backend::fetch_text()
+{
+    textRow_ = mysql_fetch_row(result_);
+    if (textRow_ == NULL)
+    {
+        textLengths_ = NULL;
+        return ef_no_data;
+    }
+
+    textLengths_ = mysql_fetch_lengths(result_);
+    numRowsFetched_ = 1;
+
+    return ef_success;
 }
 
 statement_backend::exec_fetch_result
 mysql_statement_backend::execute(int number)
 {
+    free_text_result();
+    numRowsFetched_ = 0;
+
+    session_.update_thread_id();
+    session_.set_statement_timeout(timeout_);
+
+    if (use_text_protocol())
+    {
+        return execute_text(number);
+    }
+
+    ensure_prepared();
+
     // Store the number of rows processed by this call.
-    unsigned long cursorType = 0;
     if (hasVectorUseElements_)
     {
         if (mysql_stmt_attr_set(hstmt_, STMT_ATTR_ARRAY_SIZE, &vectorUseElementCount_) != 0)
@@ -152,62 +304,57 @@ mysql_statement_backend::execute(int number)
     }
     else if (hasVectorIntoElements_)
     {
-        // Do we want to use a cursor, or will that be slow???
-        cursorType = CURSOR_TYPE_READ_ONLY;
+        // The cursor type must be always set, as the statement may have been
+        // executed using a different mode before.
+        unsigned long const cursorType = resultMode_ == mysql_result_cursor
+                                            ? CURSOR_TYPE_READ_ONLY
+                                            : CURSOR_TYPE_NO_CURSOR;
         if (mysql_stmt_attr_set(hstmt_, STMT_ATTR_CURSOR_TYPE, &cursorType) != 0)
         {
             throw mysql_soci_error(std::string("Statement cursor attribute set failed - ") + mysql_stmt_error(hstmt_),
                 mysql_stmt_errno(hstmt_));
         }
 
-
-        if (mysql_stmt_attr_set(hstmt_, STMT_ATTR_PREFETCH_ROWS, &vectorIntoElementCount_) != 0)
+        if (resultMode_ == mysql_result_cursor)
         {
-            throw mysql_soci_error(std::string("Statement array attribute set failed - ") + mysql_stmt_error(hstmt_),
-                mysql_stmt_errno(hstmt_));
+            unsigned long const prefetchRows = vectorIntoElementCount_;
+            if (mysql_stmt_attr_set(hstmt_, STMT_ATTR_PREFETCH_ROWS, &prefetchRows) != 0)
+            {
+                throw mysql_soci_error(std::string("Statement array attribute set failed - ") + mysql_stmt_error(hstmt_),
+                    mysql_stmt_errno(hstmt_));
+            }
         }
-
     }
 
-    cxx_details::auto_ptr<MYSQL_BIND> parameterBindArray;
-
-    if (parameterBindingList_.size() > 0)
+    // The array size may affect the way the parameters are bound, so rebind
+    // them if it changed.
+    if (vectorUseElementCount_ != boundArraySize_)
     {
-        parameterBindArray.reset(new MYSQL_BIND[parameterBindingList_.size()]);
-
-        for (size_t bindingI = 0; bindingI < parameterBindingList_.size(); bindingI++)
-        {
-            MYSQL_BIND* bindInfo = parameterBindingList_.at(bindingI);
-            memcpy(&(parameterBindArray.get()[bindingI]), bindInfo, sizeof(MYSQL_BIND));
-        }
+        parameterBindingsChanged_ = true;
+    }
 
-        if (mysql_stmt_bind_param(hstmt_, parameterBindArray.get()) != 0)
+    if (parameterBindingsChanged_ && !parameterBindings_.empty())
+    {
+        if (mysql_stmt_bind_param(hstmt_, &parameterBindings_[0]) != 0)
         {
             throw mysql_soci_error(std::string("Parameter binding error - ") + mysql_stmt_error(hstmt_),
                 mysql_stmt_errno(hstmt_));
         }
-    }
 
-    cxx_details::auto_ptr<MYSQL_BIND> resultBindArray;
+        parameterBindingsChanged_ = false;
+        boundArraySize_ = vectorUseElementCount_;
+    }
 
-    if (resultBindingList_.size() > 0)
+    if (resultBindingsChanged_ && !resultBindings_.empty())
     {
-        resultBindArray.reset(new MYSQL_BIND[resultBindingList_.size()]);
-
-        for (size_t bindingI = 0; bindingI < resultBindingList_.size(); bindingI++)
-        {
-            MYSQL_BIND* bindInfo = resultBindingList_.at(bindingI);
-            memcpy(&(resultBindArray.get()[bindingI]), bindInfo, sizeof(MYSQL_BIND));
-        }
-
-        if (mysql_stmt_bind_result(hstmt_, resultBindArray.get()) != 0)
+        if (mysql_stmt_bind_result(hstmt_, &resultBindings_[0]) != 0)
         {
             throw mysql_soci_error(std::string("Parameter binding error - ") + mysql_stmt_error(hstmt_),
                 mysql_stmt_errno(hstmt_));
         }
-    }
-
 
+        resultBindingsChanged_ = false;
+    }
 
     // if we are called twice for the same statement we need to close the open
     // cursor or an "invalid cursor state" error will occur on execute
@@ -236,6 +383,16 @@ mysql_statement_backend::execute(int number)
 
     unsigned int colCount = mysql_stmt_field_count(hstmt_);
 
+    if (colCount > 0 && hasVectorIntoElements_ &&
+        resultMode_ == mysql_result_buffered)
+    {
+        if (mysql_stmt_store_result(hstmt_) != 0)
+        {
+            throw mysql_soci_error(std::string("Error storing the result - ") + mysql_stmt_error(hstmt_),
+                mysql_stmt_errno(hstmt_));
+        }
+    }
+
     if (number > 0 && colCount > 0)
     {
         return fetch(number);
@@ -282,6 +439,12 @@ mysql_statement_backend::fetch(int number)
 {
     numRowsFetched_ = 0;
 
+    if (result_ != NULL)
+    {
+        // Only single rows are fetched when using the text protocol.
+        return fetch_text();
+    }
+
     for (std::size_t i = 0; i != intos_.size(); ++i)
     {
         intos_[i]->resize(number);
@@ -325,11 +488,18 @@ std::string mysql_statement_backend::rewrite_for_procedure_call(
     return query;
 }
 
+void mysql_statement_backend::set_timeout(int milliseconds)
+{
+    timeout_ = milliseconds;
+}
+
 int mysql_statement_backend::prepare_for_describe()
 {
     // For efficiency, we get all the fields now, and then return them from the cached
     // list in describe_column below
 
+    ensure_prepared();
+
     metadata_ = mysql_stmt_result_metadata(hstmt_);
     if (metadata_ == NULL)
     {
@@ -24,6 +24,46 @@
 using namespace soci;
 using namespace soci::details;
 
+namespace // anonymous
+{
+
+// Functions storing the value of the current row in the vector element.
+
+template <typename T>
+void store_value(mysql_vector_into_type_backend &be, std::size_t rowNum)
+{
+    std::vector<T> &v = *static_cast<std::vector<T> *>(be.data_);
+
+    // Fixed size values are copied directly into the vector storage.
+    std::memcpy(&v[rowNum], be.buf_, sizeof(T));
+}
+
+void store_char(mysql_vector_into_type_backend &be, std::size_t rowNum)
+{
+    exchange_vector_type_cast<x_char>(be.data_)[rowNum] = be.buf_[0];
+}
+
+void store_string(mysql_vector_into_type_backend &be, std::size_t rowNum)
+{
+    vector_string_value(be.type_, be.data_, rowNum).assign(be.buf_, be.length_);
+}
+
+void store_stdtm(mysql_vector_into_type_backend &be, std::size_t rowNum)
+{
+    // See comment for the use of this macro in standard-into-type.cpp.
+    GCC_WARNING_SUPPRESS(cast-align)
+
+    MYSQL_TIME const* ts = reinterpret_cast<MYSQL_TIME const*>(be.buf_);
+
+    GCC_WARNING_RESTORE(cast-align)
+
+    details::mktime_from_ymdhms(exchange_vector_type_cast<x_stdtm>(be.data_)[rowNum],
+                                ts->year, ts->month, ts->day,
+                                ts->hour, ts->minute, ts->second);
+}
+
+} // namespace anonymous
+
 void mysql_vector_into_type_backend::define_by_pos(
     int &position, void *data, exchange_type type)
 {
@@ -46,20 +86,27 @@ void mysql_vector_into_type_backend::define_by_pos(
     case x_short:
         mysqlType_ = MYSQL_TYPE_SHORT;
         size = sizeof(short);
+        store_ = &store_value<short>;
         break;
     case x_integer:
         mysqlType_ = MYSQL_TYPE_LONG;
         size = sizeof(int);
+        store_ = &store_value<int>;
         break;
     case x_long_long:
-    case x_unsigned_long_long:
         mysqlType_ = MYSQL_TYPE_LONGLONG;
         size = sizeof(long long);
+        store_ = &store_value<long long>;
+        break;
+    case x_unsigned_long_long:
+        mysqlType_ = MYSQL_TYPE_LONGLONG;
+        size = sizeof(unsigned long long);
+        store_ = &store_value<unsigned long long>;
         break;
     case x_double:
         mysqlType_ = MYSQL_TYPE_DOUBLE;
         size = sizeof(double);
-
+        store_ = &store_value<double>;
         break;
 
     // cases that require adjustments and buffer management
@@ -68,6 +115,7 @@ void mysql_vector_into_type_backend::define_by_pos(
         mysqlType_ = MYSQL_TYPE_STRING;
         colSize_ = sizeof(char) * 2;
         size = colSize_;
+        store_ = &store_char;
         break;
     case x_stdstring:
     case x_xmltype:
@@ -79,12 +127,14 @@ void mysql_vector_into_type_backend::define_by_pos(
 
             colSize_++;
             size = colSize_;
+            store_ = &store_string;
         }
         break;
     case x_stdtm:
         mysqlType_ = MYSQL_TYPE_TIMESTAMP;
         colSize_ = sizeof(MYSQL_TIME);
         size = colSize_;
+        store_ = &store_stdtm;
         break;
     default:
         throw soci_error("Into element used with non-supported type.");
@@ -104,7 +154,7 @@ void mysql_vector_into_type_backend::define_by_pos(
     bindingInfo_.length = &length_;
     bindingInfo_.is_unsigned = (type_ == x_unsigned_long_long);
 
-    statement_.addResultBinding(&bindingInfo_);
+    statement_.setResultBinding(pos, bindingInfo_);
 }
 
 
@@ -116,170 +166,15 @@ void mysql_vector_into_type_backend::pre_fetch()
 void mysql_vector_into_type_backend::do_post_fetch_row(
     std::size_t rowNum)
 {
-
     if (isNull_)
     {
-        indicators_[rowNum] =  i_null;
+        indicators_[rowNum] = i_null;
         return;
     }
-    else
-    {
-        indicators_[rowNum] = i_ok;
-    }
-
-    if (type_ == x_integer)
-    {
-        std::vector<int>* vp
-                = static_cast<std::vector<int> *>(data_);
-        std::vector<int>& v(*vp);
-
-        v[rowNum] = *(int*)buf_;
-
-    }
-    else if (type_ == x_char)
-    {
-        std::vector<char>* vp
-            = static_cast<std::vector<char> *>(data_);
-        std::vector<char>& v(*vp);
-
-        v[rowNum] = *(char*)buf_;
-
-    }
-    else if (type_ == x_stdstring)
-    {
-        std::vector<std::string>* vp
-            = static_cast<std::vector<std::string> *>(data_);
-        std::vector<std::string>& v(*vp);
-
-        v[rowNum].assign(buf_, length_);
-
-    }
-    else if (type_ == x_long_long)
-    {
-        std::vector<long long>* vp
-            = static_cast<std::vector<long long> *>(data_);
-        std::vector<long long>& v(*vp);
 
-        v[rowNum] = *(long long*)buf_;
+    indicators_[rowNum] = i_ok;
 
-    }
-    else if (type_ == x_unsigned_long_long)
-    {
-        std::vector<unsigned long long>* vp
-            = static_cast<std::vector<unsigned long long> *>(data_);
-        std::vector<unsigned long long>& v(*vp);
-
-        v[rowNum] = *(unsigned long long*)buf_;
-
-    }
-    else if (type_ == x_short)
-    {
-        std::vector<short>* vp
-            = static_cast<std::vector<short> *>(data_);
-        std::vector<short>& v(*vp);
-
-        v[rowNum] = *(short*)buf_;
-
-    }
-    else if (type_ == x_double)
-    {
-        std::vector<double>* vp
-            = static_cast<std::vector<double> *>(data_);
-        std::vector<double>& v(*vp);
-
-        v[rowNum] = *(double*)buf_;
-    }
-    else if (type_ == x_stdtm)
-    {
-        std::vector<std::tm>* vp
-            = static_cast<std::vector<std::tm> *>(data_);
-        std::vector<std::tm>& v(*vp);
-
-        MYSQL_TIME* ts = reinterpret_cast<MYSQL_TIME*>(buf_);
-        details::mktime_from_ymdhms(v[rowNum],
-            ts->year, ts->month, ts->day,
-            ts->hour, ts->minute, ts->second);
-    }
-    else
-    {
-        throw soci_error("Unhandled type in do_post_fetch_row");
-    }
-    /*
-    else if (type_ == x_char)
-    {
-        std::vector<char> *vp
-            = static_cast<std::vector<char> *>(data_);
-
-        std::vector<char> &v(*vp);
-        char *pos = buf_;
-        for (std::size_t i = beginRow; i != endRow; ++i)
-        {
-            v[i] = *pos;
-            pos += colSize_;
-        }
-    }
-    if (type_ == x_stdstring || type_ == x_xmltype || type_ == x_longstring)
-    {
-        const char *pos = buf_;
-        for (std::size_t i = beginRow; i != endRow; ++i, pos += colSize_)
-        {
-            int len = indicator_;
-
-            std::string& value = vector_string_value(type_, data_, i);
-            if (len == -1)
-            {
-                // Value is null.
-                value.clear();
-                continue;
-            }
-
-            // Find the actual length of the string: for a VARCHAR(N)
-            // column, it may be right-padded with spaces up to the length
-            // of the longest string in the result set. This happens with
-            // at least MS SQL (and the exact behaviour depends on the
-            // value of the ANSI_PADDING option) and it seems like some
-            // other ODBC drivers also have options like "PADVARCHAR", so
-            // it's probably not the only case when it does.
-            //
-            // So deal with this generically by just trimming all the
-            // spaces from the right hand-side.
-            const char* end = pos + len;
-            while (end != pos)
-            {
-                // Pre-decrement as "end" is one past the end, as usual.
-                if (*--end != ' ')
-                {
-                    // We must count the last non-space character.
-                    ++end;
-                    break;
-                }
-            }
-
-            value.assign(pos, end - pos);
-        }
-    }
-    else if (type_ == x_stdtm)
-    {
-        std::vector<std::tm> *vp
-            = static_cast<std::vector<std::tm> *>(data_);
-
-        std::vector<std::tm> &v(*vp);
-        char *pos = buf_;
-        for (std::size_t i = beginRow; i != endRow; ++i)
-        {
-            // See comment for the use of this macro in standard-into-type.cpp.
-            GCC_WARNING_SUPPRESS(cast-align)
-
-            MYSQL_TIME* ts = reinterpret_cast<MYSQL_TIME*>(pos);
-
-            GCC_WARNING_RESTORE(cast-align)
-
-            details::mktime_from_ymdhms(v[i],
-                                        ts->year, ts->month, ts->day,
-                                        ts->hour, ts->minute, ts->second);
-            pos += colSize_;
-        }
-    }*/
+    store_(*this, rowNum);
 }
 
 void mysql_vector_into_type_backend::post_fetch(bool gotData, indicator* ind)
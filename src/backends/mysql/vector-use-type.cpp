@@ -95,19 +95,17 @@ void* mysql_vector_use_type_backend::prepare_for_bind(unsigned long &size,
             size = sizeof(char);
             // The buffer is an array of pointers to the actual char data
             // size is the size of the data at that pointer, not the size of the pointer itself
-            buf_ = new char[sizeof (void*) * vsize];
-
-            char **pos = reinterpret_cast<char**>(buf_);
+            pointers_.resize(vsize);
 
             // 1 is the default value for all the lengths
             lengths_.resize(vsize, 1);
             for (std::size_t i = 0; i != vsize; ++i)
             {
-                *pos++ = &(*vp)[i];
+                pointers_[i] = &(*vp)[i];
             }
 
             sqlType = MYSQL_TYPE_STRING;
-            data = buf_;
+            data = &pointers_[0];
         }
         break;
     case x_stdstring:
@@ -119,9 +117,7 @@ void* mysql_vector_use_type_backend::prepare_for_bind(unsigned long &size,
             lengths_.resize(vecSize);
 
             // The buffer contains an array of pointers to the actual text strings
-            buf_ = new char[sizeof(void*) * vecSize];
-
-            const char** ptrBuffer = reinterpret_cast<const char**>(buf_);
+            pointers_.resize(vecSize);
 
             for (std::size_t i = 0; i != vecSize; ++i)
             {
@@ -132,11 +128,10 @@ void* mysql_vector_use_type_backend::prepare_for_bind(unsigned long &size,
                 indHolderVec_[i] = STMT_INDICATOR_NONE;
                 lengths_[i] = sz;
 
-                ptrBuffer[i] = value.data();                
-                
+                pointers_[i] = const_cast<char*>(value.data());
             }
 
-            data = buf_;
+            data = &pointers_[0];
 
             sqlType = MYSQL_TYPE_STRING;
         }
@@ -149,12 +144,12 @@ void* mysql_vector_use_type_backend::prepare_for_bind(unsigned long &size,
             prepare_indicators(vp->size());
 
             // The buffer is an array of pointers to the actual MYSQL_TIME structs
-            buf_ = new char[sizeof(void*) * vp->size()];
+            pointers_.resize(vp->size());
 
             lengths_.resize(vp->size(), sizeof(MYSQL_TIME));
 
             sqlType = MYSQL_TYPE_TIMESTAMP;
-            data = buf_;
+            data = &pointers_[0];
             size = sizeof(MYSQL_TIME);
         }
         break;
@@ -256,8 +251,6 @@ void mysql_vector_use_type_backend::pre_use(indicator const *ind)
 
                 std::vector<std::tm> &v(*vp);
 
-                MYSQL_TIME** timePointerArray = reinterpret_cast<MYSQL_TIME**>(buf_);
-
                 std::size_t const vsize = v.size();
                 timeVec_.resize(vsize);
 
@@ -274,9 +267,7 @@ void mysql_vector_use_type_backend::pre_use(indicator const *ind)
                     ts.minute = t.tm_min;
                     ts.second = t.tm_sec;
 
-                    timePointerArray[i] = &timeVec_[i];
-                    
-
+                    pointers_[i] = &timeVec_[i];
                 }
             }
             break;
@@ -337,8 +328,7 @@ void mysql_vector_use_type_backend::pre_use(indicator const *ind)
         bindingInfo_.length = lengths_.data();
     }
 
-    statement_.addParameterBinding(&bindingInfo_);
-
+    statement_.setParameterBinding(position_, bindingInfo_);
 }
 
 std::size_t mysql_vector_use_type_backend::size()
@@ -348,9 +338,5 @@ std::size_t mysql_vector_use_type_backend::size()
 
 void mysql_vector_use_type_backend::clean_up()
 {
-    if (buf_ != NULL)
-    {
-        delete [] buf_;
-        buf_ = NULL;
-    }
+    pointers_.clear();
 }
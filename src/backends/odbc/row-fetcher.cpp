@@ -0,0 +1,125 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#define SOCI_ODBC_SOURCE
+#include "soci/odbc/soci-odbc.h"
+#include "soci/statement.h"
+
+using namespace soci;
+using namespace soci::details;
+
+namespace // anonymous
+{
+
+odbc_statement_backend & get_statement_backend(statement & st)
+{
+    odbc_statement_backend * const backend =
+        dynamic_cast<odbc_statement_backend *>(st.get_backend());
+    if (!backend)
+    {
+        throw soci_error("ODBC row fetcher can only be used with statements "
+                         "using ODBC backend.");
+    }
+
+    return *backend;
+}
+
+} // namespace anonymous
+
+odbc_row_fetcher_base::odbc_row_fetcher_base(statement & st,
+                                             std::size_t rowSize)
+    : statement_(get_statement_backend(st)), rowSize_(rowSize),
+      boundRows_(NULL), numRowsFetched_(0)
+{
+}
+
+odbc_row_fetcher_base::~odbc_row_fetcher_base()
+{
+    // Don't leave the statement bound to the user memory and restore the
+    // default binding attributes expected by odbc_statement_backend.
+    if (boundRows_)
+    {
+        SQLFreeStmt(statement_.hstmt_, SQL_UNBIND);
+        SQLSetStmtAttr(statement_.hstmt_, SQL_ATTR_ROW_BIND_TYPE,
+                       SQL_BIND_BY_COLUMN, 0);
+        SQLSetStmtAttr(statement_.hstmt_, SQL_ATTR_ROWS_FETCHED_PTR, NULL, 0);
+    }
+}
+
+void odbc_row_fetcher_base::add_column(SQLSMALLINT cType, std::size_t offset,
+    SQLLEN size, bool hasInd, std::size_t indOffset)
+{
+    column_info info;
+    info.cType_ = cType;
+    info.offset_ = offset;
+    info.size_ = size;
+    info.hasInd_ = hasInd;
+    info.indOffset_ = indOffset;
+    columns_.push_back(info);
+}
+
+std::size_t odbc_row_fetcher_base::do_fetch(void * rows, std::size_t count)
+{
+    SQLHSTMT const hstmt = statement_.hstmt_;
+
+    if (rows != boundRows_)
+    {
+        char * const base = static_cast<char *>(rows);
+        for (std::size_t i = 0; i != columns_.size(); ++i)
+        {
+            column_info const & col = columns_[i];
+
+            // With row-wise binding, these are the addresses for the first
+            // row, the driver offsets them by the row size for the others.
+            SQLLEN * const ind = col.hasInd_
+                ? reinterpret_cast<SQLLEN *>(base + col.indOffset_)
+                : NULL;
+
+            SQLRETURN rc = SQLBindCol(hstmt, static_cast<SQLUSMALLINT>(i + 1),
+                col.cType_, base + col.offset_, col.size_, ind);
+            if (is_odbc_error(rc))
+            {
+                std::ostringstream ss;
+                ss << "binding column #" << i + 1 << " of the row";
+                throw odbc_soci_error(SQL_HANDLE_STMT, hstmt, ss.str());
+            }
+        }
+
+        boundRows_ = rows;
+    }
+
+    // Set the attributes every time as the statement itself changes them
+    // when fetching using into elements.
+    SQLULEN const rowSize = static_cast<SQLULEN>(rowSize_);
+    SQLRETURN rc = SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_BIND_TYPE,
+                                  (SQLPOINTER)rowSize, 0);
+    if (is_odbc_error(rc))
+    {
+        throw odbc_soci_error(SQL_HANDLE_STMT, hstmt,
+                              "setting row-wise binding");
+    }
+
+    SQLULEN const rowArraySize = static_cast<SQLULEN>(count);
+    SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER)rowArraySize, 0);
+
+    SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, &numRowsFetched_, 0);
+
+    numRowsFetched_ = 0;
+
+    rc = SQLFetch(hstmt);
+    if (rc == SQL_NO_DATA)
+    {
+        return 0;
+    }
+
+    if (is_odbc_error(rc))
+    {
+        throw odbc_soci_error(SQL_HANDLE_STMT, hstmt, "fetching data");
+    }
+
+    return static_cast<std::size_t>(numRowsFetched_);
+}
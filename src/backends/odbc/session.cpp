@@ -11,17 +11,36 @@
 #include "soci/session.h"
 
 #include "soci-autostatement.h"
+#include "soci-mutex.h"
 
 #include <cstdio>
 
 using namespace soci;
 using namespace soci::details;
 
+struct odbc_session_backend::active_statement
+{
+    active_statement() : hstmt_(NULL)
+    {
+        MUTEX_INIT(&mutex_);
+    }
+
+    ~active_statement()
+    {
+        MUTEX_DEST(&mutex_);
+    }
+
+    SQLHSTMT hstmt_;
+    soci_mutex_t mutex_;
+};
+
 char const * soci::odbc_option_driver_complete = "odbc.driver_complete";
 
 odbc_session_backend::odbc_session_backend(
     connection_parameters const & parameters)
-    : henv_(0), hdbc_(0), product_(prod_uninitialized)
+    : henv_(0), hdbc_(0), product_(prod_uninitialized),
+      dataExtensions_(0), dataExtensionsInitialized_(false),
+      activeStatement_(NULL)
 {
     SQLRETURN rc;
 
@@ -141,6 +160,9 @@ odbc_session_backend::odbc_session_backend(
     reset_transaction();
 
     configure_connection();
+
+    // Do it last to avoid leaking it if anything above throws.
+    activeStatement_ = new active_statement;
 }
 
 void odbc_session_backend::configure_connection()
@@ -204,9 +226,37 @@ void odbc_session_backend::configure_connection()
 
 odbc_session_backend::~odbc_session_backend()
 {
+    delete activeStatement_;
+
     clean_up();
 }
 
+void odbc_session_backend::cancel()
+{
+    scoped_lock lock(&activeStatement_->mutex_);
+
+    // SQLCancel() is explicitly allowed to be called from another thread
+    // while the statement is being executed by the driver.
+    SQLHSTMT const hstmt = activeStatement_->hstmt_;
+    if (hstmt == NULL)
+        return;
+
+    SQLRETURN rc = SQLCancel(hstmt);
+    if (is_odbc_error(rc))
+    {
+        throw odbc_soci_error(SQL_HANDLE_STMT, hstmt, "cancelling statement");
+    }
+}
+
+SQLHSTMT odbc_session_backend::set_active_statement(SQLHSTMT hstmt)
+{
+    scoped_lock lock(&activeStatement_->mutex_);
+
+    SQLHSTMT const prev = activeStatement_->hstmt_;
+    activeStatement_->hstmt_ = hstmt;
+    return prev;
+}
+
 bool odbc_session_backend::is_connected()
 {
     details::auto_statement<odbc_statement_backend> st(*this);
@@ -479,3 +529,21 @@ odbc_session_backend::get_database_product() const
 
     return product_;
 }
+
+SQLUINTEGER odbc_session_backend::get_data_extensions() const
+{
+    if (dataExtensionsInitialized_)
+        return dataExtensions_;
+
+    // Don't consider failing to get this information as an error, just
+    // assume that no extensions are supported then.
+    SQLUINTEGER extensions = 0;
+    SQLRETURN rc = SQLGetInfo(hdbc_, SQL_GETDATA_EXTENSIONS,
+                              &extensions, sizeof(extensions), NULL);
+    if (!is_odbc_error(rc))
+        dataExtensions_ = extensions;
+
+    dataExtensionsInitialized_ = true;
+
+    return dataExtensions_;
+}
@@ -8,6 +8,7 @@
 #define SOCI_ODBC_SOURCE
 #include "soci/odbc/soci-odbc.h"
 #include <cctype>
+#include <climits>
 #include <sstream>
 #include <cstring>
 
@@ -17,11 +18,37 @@ using namespace soci::details;
 
 odbc_statement_backend::odbc_statement_backend(odbc_session_backend &session)
     : session_(session), hstmt_(0), numRowsFetched_(0), fetchVectorByRows_(false),
-      hasVectorUseElements_(false), boundByName_(false), boundByPos_(false),
-      rowsAffected_(-1LL)
+      longColumnsMode_(long_columns_none), hasVectorUseElements_(false), boundByName_(false), boundByPos_(false),
+      rowsAffected_(-1LL), timeout_(0)
 {
 }
 
+namespace // anonymous
+{
+
+// Makes the statement the active one for cancelling during its lifetime.
+class active_statement_guard
+{
+public:
+    active_statement_guard(odbc_session_backend &session, SQLHSTMT hstmt)
+        : session_(session), prev_(session.set_active_statement(hstmt))
+    {
+    }
+
+    ~active_statement_guard()
+    {
+        session_.set_active_statement(prev_);
+    }
+
+private:
+    odbc_session_backend &session_;
+    SQLHSTMT const prev_;
+
+    SOCI_NOT_COPYABLE(active_statement_guard)
+};
+
+} // namespace anonymous
+
 void odbc_statement_backend::alloc()
 {
     SQLRETURN rc;
@@ -33,11 +60,36 @@ void odbc_statement_backend::alloc()
         throw odbc_soci_error(SQL_HANDLE_DBC, session_.hdbc_,
                               "allocating statement");
     }
+
+    if (timeout_)
+    {
+        apply_timeout();
+    }
+}
+
+void odbc_statement_backend::set_timeout(int milliseconds)
+{
+    timeout_ = milliseconds;
+
+    apply_timeout();
+}
+
+void odbc_statement_backend::apply_timeout()
+{
+    SQLULEN const seconds = static_cast<SQLULEN>((timeout_ + 999) / 1000);
+    SQLRETURN rc = SQLSetStmtAttr(hstmt_, SQL_ATTR_QUERY_TIMEOUT,
+                                  (SQLPOINTER)seconds, 0);
+    if (is_odbc_error(rc))
+    {
+        throw odbc_soci_error(SQL_HANDLE_STMT, hstmt_,
+                              "setting query timeout");
+    }
 }
 
 void odbc_statement_backend::clean_up()
 {
     rowsAffected_ = -1LL;
+    longColumnsMode_ = long_columns_none;
 
     SQLFreeHandle(SQL_HANDLE_STMT, hstmt_);
 }
@@ -135,6 +187,7 @@ void odbc_statement_backend::prepare(std::string const & query,
     // reset any old into buffers, they will be added later if they're used
     // with this query
     intos_.clear();
+    longColumnsMode_ = long_columns_none;
 }
 
 statement_backend::exec_fetch_result
@@ -151,6 +204,8 @@ odbc_statement_backend::execute(int number)
     // cursor or an "invalid cursor state" error will occur on execute
     SQLCloseCursor(hstmt_);
 
+    active_statement_guard activeGuard(session_, hstmt_);
+
     SQLRETURN rc = SQLExecute(hstmt_);
     if (is_odbc_error(rc))
     {
@@ -229,6 +284,31 @@ odbc_statement_backend::do_fetch(int beginRow, int endRow)
         throw odbc_soci_error(SQL_HANDLE_STMT, hstmt_, "fetching data");
     }
 
+    if (longColumnsMode_ == long_columns_get_data)
+    {
+        if (fetchVectorByRows_)
+        {
+            get_long_columns_data(beginRow);
+        }
+        else
+        {
+            // Position the cursor on each row of the rowset in turn, as
+            // SQLGetData() only works for the current row.
+            for (SQLULEN i = 0; i != numRowsFetched_; ++i)
+            {
+                rc = SQLSetPos(hstmt_, static_cast<SQLSETPOSIROW>(i + 1),
+                               SQL_POSITION, SQL_LOCK_NO_CHANGE);
+                if (is_odbc_error(rc))
+                {
+                    throw odbc_soci_error(SQL_HANDLE_STMT, hstmt_,
+                                          "positioning cursor in the rowset");
+                }
+
+                get_long_columns_data(beginRow + i);
+            }
+        }
+    }
+
     for (std::size_t j = 0; j != intos_.size(); ++j)
     {
         intos_[j]->do_post_fetch_rows(beginRow, endRow);
@@ -237,9 +317,75 @@ odbc_statement_backend::do_fetch(int beginRow, int endRow)
     return ef_success;
 }
 
+void odbc_statement_backend::get_long_columns_data(std::size_t rowInd)
+{
+    // Notice that intos_ are in the order of their positions, as required by
+    // SQLGetData() unless the driver supports SQL_GD_ANY_ORDER.
+    for (std::size_t j = 0; j != intos_.size(); ++j)
+    {
+        if (intos_[j]->longColumn_)
+            intos_[j]->get_long_column_data(rowInd);
+    }
+}
+
+void odbc_statement_backend::choose_long_columns_mode()
+{
+    SQLUINTEGER const extensions = session_.get_data_extensions();
+
+    // Unless the driver supports SQL_GD_ANY_COLUMN, SQLGetData() can only be
+    // used for the columns after the last bound one.
+    bool canGetData = true;
+    if (!(extensions & SQL_GD_ANY_COLUMN))
+    {
+        int lastBound = -1;
+        int firstLong = INT_MAX;
+        for (std::size_t j = 0; j != intos_.size(); ++j)
+        {
+            odbc_vector_into_type_backend const& into = *intos_[j];
+            if (into.longColumn_)
+            {
+                if (into.position_ < firstLong)
+                    firstLong = into.position_;
+            }
+            else if (into.position_ > lastBound)
+            {
+                lastBound = into.position_;
+            }
+        }
+
+        canGetData = lastBound < firstLong;
+    }
+
+    if (canGetData)
+    {
+        longColumnsMode_ = long_columns_get_data;
+
+        // Calling SQLGetData() for the rows of a multi-row rowset requires
+        // SQL_GD_BLOCK support, so fetch one row at a time without it: this
+        // is slower, but still doesn't require allocating huge buffers.
+        if (!(extensions & SQL_GD_BLOCK))
+            fetchVectorByRows_ = true;
+    }
+    else
+    {
+        // Fall back to binding the long columns to buffers big enough for
+        // any value, which can only be done for one row at a time.
+        longColumnsMode_ = long_columns_bound;
+        fetchVectorByRows_ = true;
+
+        for (std::size_t j = 0; j != intos_.size(); ++j)
+        {
+            if (intos_[j]->longColumn_)
+                intos_[j]->bind_long_column();
+        }
+    }
+}
+
 statement_backend::exec_fetch_result
 odbc_statement_backend::fetch(int number)
 {
+    active_statement_guard activeGuard(session_, hstmt_);
+
     numRowsFetched_ = 0;
 
     for (std::size_t i = 0; i != intos_.size(); ++i)
@@ -252,11 +398,13 @@ odbc_statement_backend::fetch(int number)
     statement_backend::exec_fetch_result res SOCI_DUMMY_INIT(ef_success);
 
     // Usually we try to fetch the entire vector at once, but if some into
-    // string columns are bigger than 8KB (ODBC_MAX_COL_SIZE) then we use
-    // 100MB buffer for that columns. So in this case we downgrade to using
-    // scalar fetches to hold the buffer only for a single row and not
-    // rows_count * 100MB.
+    // string columns are bigger than 8KB (ODBC_MAX_COL_SIZE) and their values
+    // can't be retrieved using SQLGetData() for all rows of the rowset, we
+    // downgrade to using scalar fetches.
     // See odbc_vector_into_type_backend::define_by_pos().
+    if (longColumnsMode_ == long_columns_pending)
+        choose_long_columns_mode();
+
     if (!fetchVectorByRows_)
     {
         SQLULEN row_array_size = static_cast<SQLULEN>(number);
@@ -96,22 +96,23 @@ void odbc_vector_into_type_backend::define_by_pos(
             colSize_ = static_cast<size_t>(get_sqllen_from_value(statement_.column_size(position)));
             if (colSize_ >= ODBC_MAX_COL_SIZE || colSize_ == 0)
             {
-                // Column size for text data type can be too large for buffer allocation.
-                colSize_ = odbc_max_buffer_length;
-                // If we are using huge buffer size then we need to fetch rows
-                // one by one as otherwise we could easily run out of memory.
-                // Note that the flag is permanent for the statement and will
-                // never be reset.
-                statement_.fetchVectorByRows_ = true;
+                // Column size for text data type can be too large for buffer
+                // allocation, so don't bind this column and retrieve its
+                // values in chunks using SQLGetData() after fetching the
+                // other columns instead, if the driver allows it. This is
+                // decided by the statement when fetching.
+                longColumn_ = true;
+                statement_.longColumnsMode_
+                    = odbc_statement_backend::long_columns_pending;
+
+                colSize_ = odbc_get_data_chunk_size;
+                buf_ = new char[colSize_];
+            }
+            else
+            {
+                colSize_++;
+                buf_ = new char[colSize_ * vectorSize];
             }
-
-            colSize_++;
-
-            // If we are fetching by a single row, allocate the buffer only for
-            // one value.
-            const std::size_t elementsCount
-                = statement_.fetchVectorByRows_ ? 1 : vectorSize;
-            buf_ = new char[colSize_ * elementsCount];
         }
         break;
     case x_stdtm:
@@ -132,6 +133,13 @@ void odbc_vector_into_type_backend::define_by_pos(
 
 void odbc_vector_into_type_backend::rebind_row(std::size_t rowInd)
 {
+    // Long columns are only bound if they can't be retrieved otherwise.
+    if (longColumn_ &&
+        statement_.longColumnsMode_ != odbc_statement_backend::long_columns_bound)
+    {
+        return;
+    }
+
     void* elementPtr = NULL;
     SQLLEN size = 0;
     switch (type_)
@@ -198,6 +206,68 @@ void odbc_vector_into_type_backend::rebind_row(std::size_t rowInd)
     }
 }
 
+void odbc_vector_into_type_backend::bind_long_column()
+{
+    // This buffer is used for a single row only, as all rows are fetched one
+    // by one when using it.
+    delete [] buf_;
+    buf_ = NULL;
+
+    colSize_ = odbc_max_buffer_length + 1;
+    buf_ = new char[colSize_];
+}
+
+void odbc_vector_into_type_backend::get_long_column_data(std::size_t rowInd)
+{
+    std::string& value = vector_string_value(type_, data_, rowInd);
+    value.clear();
+
+    const SQLUSMALLINT pos = static_cast<SQLUSMALLINT>(position_ + 1);
+    for (;;)
+    {
+        SQLLEN len = 0;
+        SQLRETURN rc = SQLGetData(statement_.hstmt_, pos, SQL_C_CHAR,
+            static_cast<SQLPOINTER>(buf_), static_cast<SQLLEN>(colSize_), &len);
+
+        // This is returned if the entire value was retrieved by the previous
+        // call, which returned SQL_SUCCESS_WITH_INFO for some other reason.
+        if (rc == SQL_NO_DATA)
+            break;
+
+        if (is_odbc_error(rc))
+        {
+            std::ostringstream ss;
+            ss << "getting data of column #" << pos;
+            throw odbc_soci_error(SQL_HANDLE_STMT, statement_.hstmt_, ss.str());
+        }
+
+        len = get_sqllen_from_value(len);
+        if (len == SQL_NULL_DATA)
+        {
+            set_sqllen_from_vector_at(rowInd, SQL_NULL_DATA);
+            return;
+        }
+
+        // The buffer is NUL-terminated, so if the value was truncated, it
+        // contains one character less than its size. And the length may be
+        // unknown in this case too.
+        std::size_t chunkLen = colSize_ - 1;
+        if (len != SQL_NO_TOTAL && static_cast<std::size_t>(len) < chunkLen)
+            chunkLen = static_cast<std::size_t>(len);
+
+        value.append(buf_, chunkLen);
+
+        if (rc == SQL_SUCCESS)
+            break;
+    }
+
+    // Trim the trailing spaces as for the other strings, see the comment in
+    // do_post_fetch_rows().
+    value.erase(value.find_last_not_of(' ') + 1);
+
+    set_sqllen_from_vector_at(rowInd, static_cast<SQLLEN>(value.length()));
+}
+
 void odbc_vector_into_type_backend::pre_fetch()
 {
     // nothing to do for the supported types
@@ -206,6 +276,13 @@ void odbc_vector_into_type_backend::pre_fetch()
 void odbc_vector_into_type_backend::do_post_fetch_rows(
     std::size_t beginRow, std::size_t endRow)
 {
+    // Long column values are already retrieved by get_long_column_data().
+    if (longColumn_ &&
+        statement_.longColumnsMode_ == odbc_statement_backend::long_columns_get_data)
+    {
+        return;
+    }
+
     if (type_ == x_char)
     {
         std::vector<char> *vp
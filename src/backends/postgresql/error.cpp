@@ -40,6 +40,10 @@ postgresql_soci_error::postgresql_soci_error(
     {
         cat_ = constraint_violation;
     }
+    else if (std::memcmp(sqlst, "57014", 5) == 0)
+    {
+        cat_ = query_cancelled;
+    }
     else if ((std::memcmp(sqlst, "53", 2) == 0) ||
         (std::memcmp(sqlst, "54", 2) == 0) ||
         (std::memcmp(sqlst, "58", 2) == 0) ||
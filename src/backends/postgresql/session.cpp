@@ -33,7 +33,7 @@ void hard_exec(postgresql_session_backend & session_backend,
 
 postgresql_session_backend::postgresql_session_backend(
     connection_parameters const& parameters, bool single_row_mode)
-    : statementCount_(0), conn_(0)
+    : statementCount_(0), conn_(0), cancel_(0), statementTimeout_(0)
 {
     single_row_mode_ = single_row_mode;
 
@@ -69,6 +69,9 @@ void postgresql_session_backend::connect(
 
     conn_ = conn;
     connectionParameters_ = parameters;
+
+    cancel_ = PQgetCancel(conn_);
+    statementTimeout_ = 0;
 }
 
 postgresql_session_backend::~postgresql_session_backend()
@@ -90,6 +93,21 @@ bool postgresql_session_backend::is_connected()
     return PQstatus(conn_) == CONNECTION_OK;
 }
 
+void postgresql_session_backend::cancel()
+{
+    if (!cancel_)
+    {
+        throw soci_error("Cannot cancel the query: no connection.");
+    }
+
+    // PQcancel() is thread-safe, unlike the other libpq functions.
+    char errbuf[256];
+    if (!PQcancel(cancel_, errbuf, sizeof(errbuf)))
+    {
+        throw soci_error(std::string("Cannot cancel the query: ") + errbuf);
+    }
+}
+
 void postgresql_session_backend::begin()
 {
     hard_exec(*this, conn_, "BEGIN", "Cannot begin transaction.");
@@ -102,9 +120,38 @@ void postgresql_session_backend::commit()
 
 void postgresql_session_backend::rollback()
 {
+    // Changing statement_timeout inside the transaction is undone by rolling
+    // it back, so we don't know its value any more.
+    if (statementTimeout_ != 0)
+    {
+        statementTimeout_ = -1;
+    }
+
     hard_exec(*this, conn_, "ROLLBACK", "Cannot rollback transaction.");
 }
 
+void postgresql_session_backend::set_statement_timeout(int milliseconds)
+{
+    if (milliseconds == statementTimeout_)
+    {
+        return;
+    }
+
+    if (milliseconds)
+    {
+        char query[64];
+        snprintf(query, sizeof(query), "SET statement_timeout = %d", milliseconds);
+        hard_exec(*this, conn_, query, "Cannot set statement timeout.");
+    }
+    else
+    {
+        hard_exec(*this, conn_, "SET statement_timeout TO DEFAULT",
+            "Cannot reset statement timeout.");
+    }
+
+    statementTimeout_ = milliseconds;
+}
+
 void postgresql_session_backend::deallocate_prepared_statement(
     const std::string & statementName)
 {
@@ -124,6 +171,12 @@ bool postgresql_session_backend::get_next_sequence_value(
 
 void postgresql_session_backend::clean_up()
 {
+    if (0 != cancel_)
+    {
+        PQfreeCancel(cancel_);
+        cancel_ = 0;
+    }
+
     if (0 != conn_)
     {
         PQfinish(conn_);
@@ -57,9 +57,10 @@ postgresql_statement_backend::postgresql_statement_backend(
     postgresql_session_backend &session, bool single_row_mode)
     : session_(session), single_row_mode_(single_row_mode),
       result_(session, NULL),
-      rowsAffectedBulk_(-1LL), justDescribed_(false),
+      rowsAffectedBulk_(-1LL), justDescribed_(false), asyncPending_(false),
       hasIntoElements_(false), hasVectorIntoElements_(false),
-      hasUseElements_(false), hasVectorUseElements_(false)
+      hasUseElements_(false), hasVectorUseElements_(false),
+      timeout_(0)
 {
 #ifdef SOCI_POSTGRESQL_NOSINGLEROWMODE
   if (single_row_mode)
@@ -262,122 +263,106 @@ void postgresql_statement_backend::prepare(std::string const & query,
     stType_ = stType;
 }
 
-statement_backend::exec_fetch_result
-postgresql_statement_backend::execute(int number)
+bool postgresql_statement_backend::send_query(int number, bool async)
 {
-#ifndef SOCI_POSTGRESQL_NOSINGLEROWMODE
-    if (single_row_mode_ && (number > 1))
+    // This object could have been already filled with data before.
+    clean_up();
+
+    if ((number > 1) && hasIntoElements_)
     {
-        throw soci_error("Bulk operations are not supported with single-row mode.");
+         throw soci_error(
+              "Bulk use with single into elements is not supported.");
     }
-#endif // !SOCI_POSTGRESQL_NOSINGLEROWMODE
 
-    // If the statement was "just described", then we know that
-    // it was actually executed with all the use elements
-    // already bound and pre-used. This means that the result of the
-    // query is already on the client side, so there is no need
-    // to re-execute it.
-    // The optimization based on the existing results
-    // from the row description can be performed only once.
-    // If the same statement is re-executed,
-    // it will be *really* re-executed, without reusing existing data.
+    session_.set_statement_timeout(timeout_);
+
+    // Since the bulk operations are not natively supported by postgresql_,
+    // we have to explicitly loop to achieve the bulk operations.
+    // On the other hand, looping is not needed if there are single
+    // use elements, even if there is a bulk fetch.
+    // We know that single use and bulk use elements in the same query are
+    // not supported anyway, so in the effect the 'number' parameter here
+    // specifies the size of vectors (into/use), but 'numberOfExecutions'
+    // specifies the number of loops that need to be performed.
 
-    if (justDescribed_ == false)
+    int numberOfExecutions = 1;
+    if (number > 0)
     {
-        // This object could have been already filled with data before.
-        clean_up();
+         numberOfExecutions = hasUseElements_ ? 1 : number;
+    }
 
-        if ((number > 1) && hasIntoElements_)
+    if ((useByPosBuffers_.empty() == false) ||
+        (useByNameBuffers_.empty() == false))
+    {
+        if ((useByPosBuffers_.empty() == false) &&
+            (useByNameBuffers_.empty() == false))
         {
-             throw soci_error(
-                  "Bulk use with single into elements is not supported.");
+            throw soci_error(
+                "Binding for use elements must be either by position "
+                "or by name.");
         }
-
-        // Since the bulk operations are not natively supported by postgresql_,
-        // we have to explicitly loop to achieve the bulk operations.
-        // On the other hand, looping is not needed if there are single
-        // use elements, even if there is a bulk fetch.
-        // We know that single use and bulk use elements in the same query are
-        // not supported anyway, so in the effect the 'number' parameter here
-        // specifies the size of vectors (into/use), but 'numberOfExecutions'
-        // specifies the number of loops that need to be performed.
-
-        int numberOfExecutions = 1;
-        if (number > 0)
+        long long rowsAffectedBulkTemp = 0;
+        for (int i = 0; i != numberOfExecutions; ++i)
         {
-             numberOfExecutions = hasUseElements_ ? 1 : number;
-        }
+            std::vector<char *> paramValues;
 
-        if ((useByPosBuffers_.empty() == false) ||
-            (useByNameBuffers_.empty() == false))
-        {
-            if ((useByPosBuffers_.empty() == false) &&
-                (useByNameBuffers_.empty() == false))
+            if (useByPosBuffers_.empty() == false)
             {
-                throw soci_error(
-                    "Binding for use elements must be either by position "
-                    "or by name.");
+                // use elements bind by position
+                // the map of use buffers can be traversed
+                // in its natural order
+
+                for (UseByPosBuffersMap::iterator
+                         it = useByPosBuffers_.begin(),
+                         end = useByPosBuffers_.end();
+                     it != end; ++it)
+                {
+                    char ** buffers = it->second;
+                    paramValues.push_back(buffers[i]);
+                }
             }
-            long long rowsAffectedBulkTemp = 0;
-            for (int i = 0; i != numberOfExecutions; ++i)
+            else
             {
-                std::vector<char *> paramValues;
+                // use elements bind by name
 
-                if (useByPosBuffers_.empty() == false)
+                for (std::vector<std::string>::iterator
+                         it = names_.begin(), end = names_.end();
+                     it != end; ++it)
                 {
-                    // use elements bind by position
-                    // the map of use buffers can be traversed
-                    // in its natural order
-
-                    for (UseByPosBuffersMap::iterator
-                             it = useByPosBuffers_.begin(),
-                             end = useByPosBuffers_.end();
-                         it != end; ++it)
+                    UseByNameBuffersMap::iterator b
+                        = useByNameBuffers_.find(*it);
+                    if (b == useByNameBuffers_.end())
                     {
-                        char ** buffers = it->second;
-                        paramValues.push_back(buffers[i]);
+                        std::string msg(
+                            "Missing use element for bind by name (");
+                        msg += *it;
+                        msg += ").";
+                        throw soci_error(msg);
                     }
+                    char ** buffers = b->second;
+                    paramValues.push_back(buffers[i]);
                 }
-                else
-                {
-                    // use elements bind by name
+            }
 
-                    for (std::vector<std::string>::iterator
-                             it = names_.begin(), end = names_.end();
-                         it != end; ++it)
-                    {
-                        UseByNameBuffersMap::iterator b
-                            = useByNameBuffers_.find(*it);
-                        if (b == useByNameBuffers_.end())
-                        {
-                            std::string msg(
-                                "Missing use element for bind by name (");
-                            msg += *it;
-                            msg += ").";
-                            throw soci_error(msg);
-                        }
-                        char ** buffers = b->second;
-                        paramValues.push_back(buffers[i]);
-                    }
-                }
+            if (stType_ == st_repeatable_query)
+            {
+                // this query was separately prepared
 
-                if (stType_ == st_repeatable_query)
+#ifndef SOCI_POSTGRESQL_NOSINGLEROWMODE
+                if (single_row_mode_ || async)
                 {
-                    // this query was separately prepared
+                    int result = PQsendQueryPrepared(session_.conn_,
+                        statementName_.c_str(),
+                        static_cast<int>(paramValues.size()),
+                        &paramValues[0], NULL, NULL, 0);
+                    if (result != 1)
+                    {
+                        throw_soci_error(session_.conn_,
+                            "Cannot execute prepared query in single-row mode");
+                    }
 
-#ifndef SOCI_POSTGRESQL_NOSINGLEROWMODE
                     if (single_row_mode_)
                     {
-                        int result = PQsendQueryPrepared(session_.conn_,
-                            statementName_.c_str(),
-                            static_cast<int>(paramValues.size()),
-                            &paramValues[0], NULL, NULL, 0);
-                        if (result != 1)
-                        {
-                            throw_soci_error(session_.conn_,
-                                "Cannot execute prepared query in single-row mode");
-                        }
-
                         result = PQsetSingleRowMode(session_.conn_);
                         if (result != 1)
                         {
@@ -385,34 +370,37 @@ postgresql_statement_backend::execute(int number)
                                 "Cannot set singlerow mode");
                         }
                     }
-                    else
+                }
+                else
 #endif // !SOCI_POSTGRESQL_NOSINGLEROWMODE
-                    {
-                        // default multi-row execution
+                {
+                    // default multi-row execution
 
-                        result_.reset(PQexecPrepared(session_.conn_,
-                                statementName_.c_str(),
-                                static_cast<int>(paramValues.size()),
-                                &paramValues[0], NULL, NULL, 0));
-                    }
+                    result_.reset(PQexecPrepared(session_.conn_,
+                            statementName_.c_str(),
+                            static_cast<int>(paramValues.size()),
+                            &paramValues[0], NULL, NULL, 0));
                 }
-                else // stType_ == st_one_time_query
-                {
-                    // this query was not separately prepared and should
-                    // be executed as a one-time query
+            }
+            else // stType_ == st_one_time_query
+            {
+                // this query was not separately prepared and should
+                // be executed as a one-time query
 
 #ifndef SOCI_POSTGRESQL_NOSINGLEROWMODE
-                    if (single_row_mode_)
+                if (single_row_mode_ || async)
+                {
+                    int result = PQsendQueryParams(session_.conn_, query_.c_str(),
+                        static_cast<int>(paramValues.size()),
+                        NULL, &paramValues[0], NULL, NULL, 0);
+                    if (result != 1)
                     {
-                        int result = PQsendQueryParams(session_.conn_, query_.c_str(),
-                            static_cast<int>(paramValues.size()),
-                            NULL, &paramValues[0], NULL, NULL, 0);
-                        if (result != 1)
-                        {
-                            throw_soci_error(session_.conn_,
-                                "cannot execute query in single-row mode");
-                        }
+                        throw_soci_error(session_.conn_,
+                            "cannot execute query in single-row mode");
+                    }
 
+                    if (single_row_mode_)
+                    {
                         result = PQsetSingleRowMode(session_.conn_);
                         if (result != 1)
                         {
@@ -420,59 +408,62 @@ postgresql_statement_backend::execute(int number)
                                 "Cannot set singlerow mode");
                         }
                     }
-                    else
-#endif // !SOCI_POSTGRESQL_NOSINGLEROWMODE
-                    {
-                        // default multi-row execution
-
-                        result_.reset(PQexecParams(session_.conn_, query_.c_str(),
-                                static_cast<int>(paramValues.size()),
-                                NULL, &paramValues[0], NULL, NULL, 0));
-                    }
                 }
-
-                if (numberOfExecutions > 1)
+                else
+#endif // !SOCI_POSTGRESQL_NOSINGLEROWMODE
                 {
-                    // there are only bulk use elements (no intos)
-
-                    // preserve the number of rows affected so far.
-                    rowsAffectedBulk_ = rowsAffectedBulkTemp;
-
-                    result_.check_for_errors("Cannot execute query.");
+                    // default multi-row execution
 
-                    rowsAffectedBulkTemp += get_affected_rows();
+                    result_.reset(PQexecParams(session_.conn_, query_.c_str(),
+                            static_cast<int>(paramValues.size()),
+                            NULL, &paramValues[0], NULL, NULL, 0));
                 }
             }
-            rowsAffectedBulk_ = rowsAffectedBulkTemp;
 
             if (numberOfExecutions > 1)
             {
-                // it was a bulk operation
-                result_.reset();
-                return ef_no_data;
+                // there are only bulk use elements (no intos)
+
+                // preserve the number of rows affected so far.
+                rowsAffectedBulk_ = rowsAffectedBulkTemp;
+
+                result_.check_for_errors("Cannot execute query.");
+
+                rowsAffectedBulkTemp += get_affected_rows();
             }
+        }
+        rowsAffectedBulk_ = rowsAffectedBulkTemp;
 
-            // otherwise (no bulk), follow the code below
+        if (numberOfExecutions > 1)
+        {
+            // it was a bulk operation
+            result_.reset();
+            return false;
         }
-        else
+
+        // otherwise (no bulk), follow the code below
+    }
+    else
+    {
+        // there are no use elements
+        // - execute the query without parameter information
+        if (stType_ == st_repeatable_query)
         {
-            // there are no use elements
-            // - execute the query without parameter information
-            if (stType_ == st_repeatable_query)
-            {
-                // this query was separately prepared
+            // this query was separately prepared
 
 #ifndef SOCI_POSTGRESQL_NOSINGLEROWMODE
-                if (single_row_mode_)
+            if (single_row_mode_ || async)
+            {
+                int result = PQsendQueryPrepared(session_.conn_,
+                    statementName_.c_str(), 0, NULL, NULL, NULL, 0);
+                if (result != 1)
                 {
-                    int result = PQsendQueryPrepared(session_.conn_,
-                        statementName_.c_str(), 0, NULL, NULL, NULL, 0);
-                    if (result != 1)
-                    {
-                        throw_soci_error(session_.conn_,
-                            "Cannot execute prepared query in single-row mode");
-                    }
+                    throw_soci_error(session_.conn_,
+                        "Cannot execute prepared query in single-row mode");
+                }
 
+                if (single_row_mode_)
+                {
                     result = PQsetSingleRowMode(session_.conn_);
                     if (result != 1)
                     {
@@ -480,27 +471,30 @@ postgresql_statement_backend::execute(int number)
                             "Cannot set singlerow mode");
                     }
                 }
-                else
+            }
+            else
 #endif // !SOCI_POSTGRESQL_NOSINGLEROWMODE
-                {
-                    // default multi-row execution
+            {
+                // default multi-row execution
 
-                    result_.reset(PQexecPrepared(session_.conn_,
-                            statementName_.c_str(), 0, NULL, NULL, NULL, 0));
-                }
+                result_.reset(PQexecPrepared(session_.conn_,
+                        statementName_.c_str(), 0, NULL, NULL, NULL, 0));
             }
-            else // stType_ == st_one_time_query
-            {
+        }
+        else // stType_ == st_one_time_query
+        {
 #ifndef SOCI_POSTGRESQL_NOSINGLEROWMODE
-                if (single_row_mode_)
+            if (single_row_mode_ || async)
+            {
+                int result = PQsendQuery(session_.conn_, query_.c_str());
+                if (result != 1)
                 {
-                    int result = PQsendQuery(session_.conn_, query_.c_str());
-                    if (result != 1)
-                    {
-                        throw_soci_error(session_.conn_,
-                            "Cannot execute query in single-row mode");
-                    }
+                    throw_soci_error(session_.conn_,
+                        "Cannot execute query in single-row mode");
+                }
 
+                if (single_row_mode_)
+                {
                     result = PQsetSingleRowMode(session_.conn_);
                     if (result != 1)
                     {
@@ -508,17 +502,56 @@ postgresql_statement_backend::execute(int number)
                             "Cannot set single-row mode");
                     }
                 }
-                else
+            }
+            else
 #endif // !SOCI_POSTGRESQL_NOSINGLEROWMODE
-                {
-                    // default multi-row execution
+            {
+                // default multi-row execution
 
-                    result_.reset(PQexec(session_.conn_, query_.c_str()));
-                }
+                result_.reset(PQexec(session_.conn_, query_.c_str()));
             }
         }
     }
 
+    return true;
+}
+
+statement_backend::exec_fetch_result
+postgresql_statement_backend::execute(int number)
+{
+#ifndef SOCI_POSTGRESQL_NOSINGLEROWMODE
+    if (single_row_mode_ && (number > 1))
+    {
+        throw soci_error("Bulk operations are not supported with single-row mode.");
+    }
+#endif // !SOCI_POSTGRESQL_NOSINGLEROWMODE
+
+    // If the statement was "just described", then we know that
+    // it was actually executed with all the use elements
+    // already bound and pre-used. This means that the result of the
+    // query is already on the client side, so there is no need
+    // to re-execute it.
+    // The optimization based on the existing results
+    // from the row description can be performed only once.
+    // If the same statement is re-executed,
+    // it will be *really* re-executed, without reusing existing data.
+
+    bool sentAsync = false;
+    if (asyncPending_)
+    {
+        // The query was already sent by send_execute().
+        asyncPending_ = false;
+        sentAsync = true;
+    }
+    else if (justDescribed_ == false)
+    {
+        if (send_query(number, false) == false)
+        {
+            // it was a bulk operation
+            return ef_no_data;
+        }
+    }
+
     bool process_result;
 #ifndef SOCI_POSTGRESQL_NOSINGLEROWMODE
     if (single_row_mode_)
@@ -541,6 +574,33 @@ postgresql_statement_backend::execute(int number)
     {
         // default multi-row execution
 
+#ifndef SOCI_POSTGRESQL_NOSINGLEROWMODE
+        if (sentAsync)
+        {
+            // Collect the results of the query sent by send_execute(): keep
+            // the last one, as PQexec() does, unless an error occurred.
+            result_.reset();
+            for (;;)
+            {
+                PGresult * res = PQgetResult(session_.conn_);
+                if (res == NULL)
+                {
+                    break;
+                }
+
+                if (result_.get_result() != NULL &&
+                    PQresultStatus(result_) == PGRES_FATAL_ERROR)
+                {
+                    PQclear(res);
+                }
+                else
+                {
+                    result_.reset(res);
+                }
+            }
+        }
+#endif // !SOCI_POSTGRESQL_NOSINGLEROWMODE
+
         process_result = result_.check_for_data("Cannot execute query.");
     }
 
@@ -594,6 +654,9 @@ postgresql_statement_backend::fetch(int number)
     // Here, we only prepare for this to happen (to emulate "the Oracle way").
     // In the single-row mode the fetch of single row of data is performed as expected.
 
+    // Any row requested by send_fetch() is retrieved below.
+    asyncPending_ = false;
+
     // forward the "cursor" from the last fetch
     currentRow_ += rowsToConsume_;
 
@@ -677,6 +740,72 @@ postgresql_statement_backend::fetch(int number)
     }
 }
 
+bool postgresql_statement_backend::send_execute(int number)
+{
+#ifndef SOCI_POSTGRESQL_NOSINGLEROWMODE
+    if (single_row_mode_ && (number > 1))
+    {
+        // Let execute() throw the error.
+        return false;
+    }
+
+    if (justDescribed_)
+    {
+        // The result is already available, see execute().
+        return true;
+    }
+
+    // Bulk operations execute the query once per row and so can't be sent
+    // all at once.
+    if ((number > 1) && (hasUseElements_ == false) &&
+        ((useByPosBuffers_.empty() == false) ||
+         (useByNameBuffers_.empty() == false)))
+    {
+        return false;
+    }
+
+    send_query(number, true);
+    asyncPending_ = true;
+
+    return true;
+#else // SOCI_POSTGRESQL_NOSINGLEROWMODE
+    (void)number;
+
+    return false;
+#endif // !SOCI_POSTGRESQL_NOSINGLEROWMODE
+}
+
+bool postgresql_statement_backend::send_fetch(int /* number */)
+{
+#ifndef SOCI_POSTGRESQL_NOSINGLEROWMODE
+    // Only the single-row mode needs to get more data from the server, which
+    // is being sent to us anyhow, so there is nothing to do here except
+    // remembering to wait for it in is_result_ready().
+    if (single_row_mode_ && (currentRow_ + rowsToConsume_ >= numberOfRows_))
+    {
+        asyncPending_ = true;
+    }
+#endif // !SOCI_POSTGRESQL_NOSINGLEROWMODE
+
+    return true;
+}
+
+bool postgresql_statement_backend::is_result_ready()
+{
+    if (asyncPending_ == false)
+    {
+        return true;
+    }
+
+    // If reading fails, let execute() or fetch() report the error.
+    if (PQconsumeInput(session_.conn_) == 0)
+    {
+        return true;
+    }
+
+    return PQisBusy(session_.conn_) == 0;
+}
+
 long long postgresql_statement_backend::get_affected_rows()
 {
     // PQcmdTuples() doesn't really modify the result but it takes a non-const
@@ -716,6 +845,11 @@ std::string postgresql_statement_backend::rewrite_for_procedure_call(
     return newQuery;
 }
 
+void postgresql_statement_backend::set_timeout(int milliseconds)
+{
+    timeout_ = milliseconds;
+}
+
 int postgresql_statement_backend::prepare_for_describe()
 {
     execute(1);
@@ -0,0 +1,179 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#define SOCI_SQLITE3_SOURCE
+#include "soci/sqlite3/soci-sqlite3.h"
+#include "soci/session.h"
+
+using namespace soci;
+using namespace sqlite_api;
+
+namespace // anonymous
+{
+
+// Time to wait before retrying a step when the database is locked, in ms.
+int const lockedRetryDelay = 10;
+
+sqlite_api::sqlite3 * get_connection(session & sql)
+{
+    sqlite3_session_backend * const backend =
+        dynamic_cast<sqlite3_session_backend *>(sql.get_backend());
+    if (!backend)
+    {
+        throw soci_error("SQLite backup can only be used with sessions "
+                         "connected using SQLite backend.");
+    }
+
+    return backend->conn_;
+}
+
+} // namespace anonymous
+
+sqlite3_backup_copy::sqlite3_backup_copy(session & destination,
+                                         session & source)
+    : file_(NULL), destination_(NULL), backup_(NULL),
+      remaining_(0), pageCount_(0), done_(false)
+{
+    init(get_connection(destination), get_connection(source));
+}
+
+sqlite3_backup_copy::sqlite3_backup_copy(session & sql,
+                                         std::string const & fileName,
+                                         direction dir)
+    : file_(NULL), destination_(NULL), backup_(NULL),
+      remaining_(0), pageCount_(0), done_(false)
+{
+    sqlite_api::sqlite3 * const conn = get_connection(sql);
+
+    int const flags = dir == load_from_file
+                        ? SQLITE_OPEN_READONLY
+                        : SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE;
+    int const res = sqlite3_open_v2(fileName.c_str(), &file_, flags, NULL);
+    if (res != SQLITE_OK)
+    {
+        std::string const msg = file_ ? sqlite3_errmsg(file_)
+                                      : "out of memory";
+        sqlite3_close(file_);
+        throw sqlite3_soci_error("Cannot open database file \"" + fileName +
+                                 "\" for backup: " + msg, res);
+    }
+
+    try
+    {
+        if (dir == load_from_file)
+            init(conn, file_);
+        else
+            init(file_, conn);
+    }
+    catch (...)
+    {
+        sqlite3_close(file_);
+        throw;
+    }
+}
+
+sqlite3_backup_copy::~sqlite3_backup_copy()
+{
+    // Errors are ignored here, use step() or run() to get them.
+    if (backup_)
+        sqlite3_backup_finish(backup_);
+
+    if (file_)
+        sqlite3_close(file_);
+}
+
+void sqlite3_backup_copy::init(sqlite_api::sqlite3 * destination,
+                               sqlite_api::sqlite3 * source)
+{
+    destination_ = destination;
+
+    backup_ = sqlite3_backup_init(destination, "main", source, "main");
+    if (!backup_)
+    {
+        // The error is stored in the destination connection.
+        throw sqlite3_soci_error(std::string("Cannot start backup: ") +
+                                 sqlite3_errmsg(destination),
+                                 sqlite3_errcode(destination));
+    }
+}
+
+void sqlite3_backup_copy::finish()
+{
+    int const res = sqlite3_backup_finish(backup_);
+    backup_ = NULL;
+
+    if (res != SQLITE_OK)
+    {
+        throw sqlite3_soci_error(std::string("Backup failed: ") +
+                                 sqlite3_errmsg(destination_), res);
+    }
+}
+
+bool sqlite3_backup_copy::step(int pages)
+{
+    return do_step(pages) == SQLITE_DONE;
+}
+
+int sqlite3_backup_copy::do_step(int pages)
+{
+    if (done_)
+        return SQLITE_DONE;
+
+    if (!backup_)
+        throw soci_error("Backup can't continue after a previous error.");
+
+    int const res = sqlite3_backup_step(backup_, pages);
+
+    remaining_ = sqlite3_backup_remaining(backup_);
+    pageCount_ = sqlite3_backup_pagecount(backup_);
+
+    switch (res)
+    {
+        case SQLITE_DONE:
+            done_ = true;
+            finish();
+            break;
+
+        case SQLITE_OK:
+        case SQLITE_BUSY:
+        case SQLITE_LOCKED:
+            break;
+
+        default:
+            // The error is returned by sqlite3_backup_finish() too, so this
+            // throws.
+            finish();
+            throw sqlite3_soci_error("Backup failed.", res);
+    }
+
+    return res;
+}
+
+void sqlite3_backup_copy::run(int pagesPerStep, int sleepMs,
+                              sqlite3_backup_progress * progress)
+{
+    for (;;)
+    {
+        int const res = do_step(pagesPerStep);
+
+        if (progress)
+            progress->on_step(remaining_, pageCount_);
+
+        if (res == SQLITE_DONE)
+            break;
+
+        if (res != SQLITE_OK)
+        {
+            // The database is locked, wait a bit before retrying.
+            sqlite3_sleep(sleepMs > 0 ? sleepMs : lockedRetryDelay);
+        }
+        else if (sleepMs > 0)
+        {
+            sqlite3_sleep(sleepMs);
+        }
+    }
+}
@@ -10,109 +10,275 @@
 
 #include <algorithm>
 #include <cstring>
+#include <limits>
+#include <sstream>
 
 using namespace soci;
+using namespace sqlite_api;
+
+namespace // anonymous
+{
+
+// Return the identifier quoted as required by SQLite, i.e. with any embedded
+// double quotes doubled.
+std::string quote_identifier(std::string const &name)
+{
+    std::string quoted = "\"";
+    for (std::string::const_iterator it = name.begin(); it != name.end(); ++it)
+    {
+        if (*it == '"')
+            quoted += '"';
+        quoted += *it;
+    }
+    quoted += '"';
+
+    return quoted;
+}
+
+} // namespace anonymous
 
 sqlite3_blob_backend::sqlite3_blob_backend(sqlite3_session_backend &session)
-    : session_(session), buf_(0), len_(0)
+    : session_(session), len_(0), blob_(NULL), appendPos_(0), readOnly_(false)
 {
 }
 
 sqlite3_blob_backend::~sqlite3_blob_backend()
 {
-    if (buf_)
+    if (blob_)
+    {
+        // Ignore the errors here, there is nothing we can do about them.
+        sqlite3_blob_close(blob_);
+    }
+}
+
+void sqlite3_blob_backend::check_result(int res, char const *operation)
+{
+    if (res != SQLITE_OK)
     {
-        delete [] buf_;
-        buf_ = 0;
-        len_ = 0;
+        std::ostringstream ss;
+        ss << "sqlite3_blob_backend::" << operation << ": "
+           << sqlite3_errmsg(session_.conn_);
+        throw sqlite3_soci_error(ss.str(), res);
     }
 }
 
 std::size_t sqlite3_blob_backend::get_len()
 {
+    if (blob_)
+    {
+        return static_cast<std::size_t>(sqlite3_blob_bytes(blob_));
+    }
+
     return len_;
 }
 
 std::size_t sqlite3_blob_backend::read(
     std::size_t offset, char * buf, std::size_t toRead)
 {
+    std::size_t const len = get_len();
+    if (offset >= len)
+    {
+        return 0;
+    }
+
     size_t r = toRead;
 
     // make sure that we don't try to read
     // past the end of the data
-    if (r > len_ - offset)
+    if (r > len - offset)
     {
-        r = len_ - offset;
+        r = len - offset;
     }
 
-    memcpy(buf, buf_ + offset, r);
+    if (blob_)
+    {
+        check_result(sqlite3_blob_read(blob_, buf, static_cast<int>(r),
+                                       static_cast<int>(offset)),
+                     "read");
+    }
+    else
+    {
+        memcpy(buf, &buf_[offset], r);
+    }
 
     return r;
 }
 
+std::size_t sqlite3_blob_backend::read_from_start(
+    char * buf, std::size_t toRead, std::size_t offset)
+{
+    // Offsets used by read() already start from 0.
+    return read(offset, buf, toRead);
+}
 
 std::size_t sqlite3_blob_backend::write(
     std::size_t offset, char const * buf,
     std::size_t toWrite)
 {
-    const char* oldBuf = buf_;
-    std::size_t oldLen = len_;
-    len_ = (std::max)(len_, offset + toWrite);
+    if (blob_)
+    {
+        if (readOnly_)
+        {
+            throw soci_error("Blob was opened for incremental I/O in "
+                             "read-only mode.");
+        }
+
+        if (offset + toWrite > get_len())
+        {
+            throw soci_error("Writing past the end of the blob opened for "
+                             "incremental I/O is not supported.");
+        }
 
-    buf_ = new char[len_];
+        check_result(sqlite3_blob_write(blob_, buf, static_cast<int>(toWrite),
+                                        static_cast<int>(offset)),
+                     "write");
+
+        return get_len();
+    }
 
-    if (oldBuf)
+    std::size_t const newLen = (std::max)(len_, offset + toWrite);
+    if (buf_.size() < newLen)
     {
-        // we need to copy both old and new buffers
-        // it is possible that the new does not
-        // completely cover the old
-        memcpy(buf_, oldBuf, oldLen);
-        delete [] oldBuf;
+        // Grow the buffer exponentially to make appending to the blob in
+        // small chunks take linear time.
+        buf_.resize((std::max)(newLen, 2*buf_.size()));
     }
-    memcpy(buf_ + offset, buf, toWrite);
+
+    if (offset > len_)
+    {
+        // Fill the gap, if any, with zeroes, as the buffer may contain the
+        // data previously removed by trim().
+        std::fill(buf_.begin() + len_, buf_.begin() + offset, '\0');
+    }
+
+    if (toWrite)
+    {
+        memcpy(&buf_[offset], buf, toWrite);
+    }
+
+    len_ = newLen;
 
     return len_;
 }
 
+std::size_t sqlite3_blob_backend::write_from_start(
+    char const * buf, std::size_t toWrite, std::size_t offset)
+{
+    return write(offset, buf, toWrite);
+}
 
 std::size_t sqlite3_blob_backend::append(
     char const * buf, std::size_t toWrite)
 {
-    const char* oldBuf = buf_;
-
-    buf_ = new char[len_ + toWrite];
+    if (blob_)
+    {
+        write(appendPos_, buf, toWrite);
+        appendPos_ += toWrite;
 
-    memcpy(buf_, oldBuf, len_);
+        return appendPos_;
+    }
 
-    memcpy(buf_ + len_, buf, toWrite);
+    return write(len_, buf, toWrite);
+}
 
-    delete [] oldBuf;
 
-    len_ += toWrite;
+void sqlite3_blob_backend::trim(std::size_t newLen)
+{
+    if (blob_)
+    {
+        throw soci_error("Trimming the blob opened for incremental I/O "
+                         "is not supported.");
+    }
 
-    return len_;
+    if (newLen < len_)
+    {
+        len_ = newLen;
+    }
 }
 
+void sqlite3_blob_backend::open(std::string const &table,
+                                std::string const &column,
+                                sqlite3_int64 rowid, bool readOnly)
+{
+    close();
 
-void sqlite3_blob_backend::trim(std::size_t newLen)
+    check_result(sqlite3_blob_open(session_.conn_, "main",
+                                   table.c_str(), column.c_str(), rowid,
+                                   readOnly ? 0 : 1, &blob_),
+                 "open");
+
+    readOnly_ = readOnly;
+
+    // The memory used by the blob data in the default mode is not needed
+    // any more.
+    std::vector<char>().swap(buf_);
+    len_ = 0;
+}
+
+void sqlite3_blob_backend::create(std::string const &table,
+                                  std::string const &column,
+                                  sqlite3_int64 rowid, std::size_t size)
 {
-    const char* oldBuf = buf_;
-    len_ = newLen;
+    if (size > static_cast<std::size_t>((std::numeric_limits<int>::max)()))
+    {
+        throw soci_error("Blob size is too big.");
+    }
+
+    close();
+
+    std::string const query = "update " + quote_identifier(table) +
+                              " set " + quote_identifier(column) +
+                              " = ? where rowid = ?";
+
+    sqlite3_stmt *stmt = NULL;
+    check_result(sqlite3_prepare_v2(session_.conn_, query.c_str(),
+                                    static_cast<int>(query.size()),
+                                    &stmt, NULL),
+                 "create");
 
-    buf_ = new char[len_];
+    // Preallocate the space for the blob without transferring any data.
+    int res = sqlite3_bind_zeroblob(stmt, 1, static_cast<int>(size));
+    if (res == SQLITE_OK)
+        res = sqlite3_bind_int64(stmt, 2, rowid);
+    if (res == SQLITE_OK)
+    {
+        res = sqlite3_step(stmt);
+        if (res == SQLITE_DONE)
+            res = SQLITE_OK;
+    }
+
+    sqlite3_finalize(stmt);
 
-    memcpy(buf_, oldBuf, len_);
+    check_result(res, "create");
 
-    delete [] oldBuf;
+    if (sqlite3_changes(session_.conn_) == 0)
+    {
+        std::ostringstream ss;
+        ss << "sqlite3_blob_backend::create: no row with rowid " << rowid
+           << " in table \"" << table << "\"";
+        throw soci_error(ss.str());
+    }
+
+    open(table, column, rowid);
 }
 
-std::size_t sqlite3_blob_backend::set_data(char const *buf, std::size_t toWrite)
+void sqlite3_blob_backend::close()
 {
-    if (buf_)
+    if (blob_)
     {
-        delete [] buf_;
-        buf_ = 0;
-        len_ = 0;
+        sqlite3_blob * const blob = blob_;
+        blob_ = NULL;
+        appendPos_ = 0;
+
+        check_result(sqlite3_blob_close(blob), "close");
     }
+
+    len_ = 0;
+}
+
+std::size_t sqlite3_blob_backend::set_data(char const *buf, std::size_t toWrite)
+{
+    close();
+
     return write(0, buf, toWrite);
 }
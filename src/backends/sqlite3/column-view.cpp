@@ -0,0 +1,150 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#define SOCI_SQLITE3_SOURCE
+#include "soci/sqlite3/soci-sqlite3.h"
+#include "soci/statement.h"
+
+using namespace soci;
+using namespace soci::details;
+using namespace sqlite_api;
+
+void sqlite3_column_view::check_valid() const
+{
+    if (!valid_)
+    {
+        throw soci_error("SQLite column view doesn't refer to the current "
+                         "row of an existing statement.");
+    }
+}
+
+namespace soci
+{
+
+// Into element filling sqlite3_column_view with the pointers to the data
+// owned by SQLite statement.
+class sqlite3_column_view_into_type : public into_type_base
+{
+public:
+    sqlite3_column_view_into_type(sqlite3_column_view &view, indicator *ind)
+        : view_(view), ind_(ind), statement_(NULL), position_(0)
+    {
+        if (ind_)
+        {
+            *ind_ = i_null;
+        }
+    }
+
+    void define(statement_impl &st, int &position) SOCI_OVERRIDE
+    {
+        statement_ = dynamic_cast<sqlite3_statement_backend *>(st.get_backend());
+        if (!statement_)
+        {
+            throw soci_error("SQLite column view can only be used with "
+                             "SQLite backend.");
+        }
+
+        position_ = position++;
+    }
+
+    void pre_exec(int num) SOCI_OVERRIDE
+    {
+        if (num > 1)
+        {
+            throw soci_error("SQLite column view can't be used for bulk "
+                             "operations.");
+        }
+
+        invalidate();
+    }
+
+    void pre_fetch() SOCI_OVERRIDE
+    {
+        invalidate();
+    }
+
+    void post_fetch(bool gotData, bool /* calledFromFetch */) SOCI_OVERRIDE
+    {
+        if (!gotData)
+        {
+            return;
+        }
+
+        sqlite3_stmt * const stmt = statement_->stmt_;
+
+        // sqlite columns start at 0
+        int const pos = position_ - 1;
+
+        int const type = sqlite3_column_type(stmt, pos);
+        if (type == SQLITE_NULL)
+        {
+            if (!ind_)
+            {
+                throw soci_error("Null value fetched and no indicator defined.");
+            }
+
+            *ind_ = i_null;
+            view_.data_ = NULL;
+            view_.size_ = 0;
+        }
+        else
+        {
+            if (ind_)
+            {
+                *ind_ = i_ok;
+            }
+
+            // Notice that sqlite3_column_bytes() must be called after getting
+            // the pointer, as the latter may convert the value to text.
+            view_.data_ = static_cast<char const *>(type == SQLITE_BLOB
+                ? sqlite3_column_blob(stmt, pos)
+                : static_cast<void const *>(sqlite3_column_text(stmt, pos)));
+            view_.size_ = static_cast<std::size_t>(sqlite3_column_bytes(stmt, pos));
+        }
+
+        view_.valid_ = true;
+    }
+
+    void clean_up() SOCI_OVERRIDE
+    {
+        invalidate();
+    }
+
+    std::size_t size() const SOCI_OVERRIDE { return 1; }
+
+    std::size_t data_size() const SOCI_OVERRIDE
+    {
+        return view_.valid_ ? view_.size_ : 0;
+    }
+
+private:
+    void invalidate()
+    {
+        view_.data_ = NULL;
+        view_.size_ = 0;
+        view_.valid_ = false;
+    }
+
+    sqlite3_column_view &view_;
+    indicator *const ind_;
+    sqlite3_statement_backend *statement_;
+    int position_;
+
+    SOCI_NOT_COPYABLE(sqlite3_column_view_into_type)
+};
+
+into_type_ptr into(sqlite3_column_view &v)
+{
+    return into_type_ptr(new sqlite3_column_view_into_type(v, NULL));
+}
+
+into_type_ptr into(sqlite3_column_view &v, indicator &ind)
+{
+    return into_type_ptr(new sqlite3_column_view_into_type(v, &ind));
+}
+
+} // namespace soci
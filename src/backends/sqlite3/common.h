@@ -32,6 +32,81 @@ void resize_vector(void *p, std::size_t sz)
     v->resize(sz);
 }
 
+// Helpers for storing dates as the number of seconds, or smaller units, since
+// Unix epoch. They use the proleptic Gregorian calendar and UTC, like
+// SQLite own date and time functions, and are implemented without using
+// timegm() and gmtime() which are not available everywhere and can be slow.
+
+// Return the number of days since 1970-01-01 for the given date.
+inline long long days_from_civil(long long y, int m, int d)
+{
+    y -= m <= 2;
+    long long const era = (y >= 0 ? y : y - 399) / 400;
+    long long const yoe = y - era * 400;
+    long long const doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+    long long const doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+// The fields of std::tm don't need to be normalized here.
+inline long long tm_to_epoch(std::tm const &t, long long unitsPerSecond)
+{
+    // Normalize the month first, as days_from_civil() requires it.
+    long long y = t.tm_year + 1900LL + t.tm_mon / 12;
+    int m = t.tm_mon % 12;
+    if (m < 0)
+    {
+        m += 12;
+        --y;
+    }
+
+    long long const days = days_from_civil(y, m + 1, 1) + t.tm_mday - 1;
+    long long const secs = days * 86400 + t.tm_hour * 3600LL +
+                           t.tm_min * 60LL + t.tm_sec;
+
+    return secs * unitsPerSecond;
+}
+
+inline void epoch_to_tm(long long value, long long unitsPerSecond, std::tm &t)
+{
+    // Use floor division to handle dates before the epoch correctly.
+    long long secs = value / unitsPerSecond;
+    if (value % unitsPerSecond < 0)
+        --secs;
+
+    long long days = secs / 86400;
+    long long rem = secs % 86400;
+    if (rem < 0)
+    {
+        rem += 86400;
+        --days;
+    }
+
+    t = std::tm();
+    t.tm_hour = static_cast<int>(rem / 3600);
+    t.tm_min = static_cast<int>(rem % 3600 / 60);
+    t.tm_sec = static_cast<int>(rem % 60);
+
+    // 1970-01-01 was Thursday.
+    t.tm_wday = static_cast<int>((days % 7 + 11) % 7);
+
+    // This is the inverse of days_from_civil().
+    long long const z = days + 719468;
+    long long const era = (z >= 0 ? z : z - 146096) / 146097;
+    long long const doe = z - era * 146097;
+    long long const yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    long long const doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    long long const mp = (5 * doy + 2) / 153;
+    int const d = static_cast<int>(doy - (153 * mp + 2) / 5 + 1);
+    int const m = static_cast<int>(mp < 10 ? mp + 3 : mp - 9);
+    long long const y = yoe + era * 400 + (m <= 2);
+
+    t.tm_year = static_cast<int>(y - 1900);
+    t.tm_mon = m - 1;
+    t.tm_mday = d;
+    t.tm_yday = static_cast<int>(days - days_from_civil(y, 1, 1));
+}
+
 }}} // namespace soci::details::sqlite3
 
 #endif // SOCI_SQLITE3_COMMON_H_INCLUDED
@@ -21,3 +21,12 @@ int sqlite3_soci_error::result() const
 {
     return result_;
 }
+
+soci_error::error_category sqlite3_soci_error::get_error_category() const
+{
+    // Extended result codes may be used, so check only the primary one.
+    if ((result_ & 0xff) == SQLITE_INTERRUPT)
+        return query_cancelled;
+
+    return unknown;
+}
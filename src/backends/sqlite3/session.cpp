@@ -10,8 +10,10 @@
 
 #include "soci/connection-parameters.h"
 
+#include <cctype>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #ifdef _MSC_VER
 #pragma warning(disable:4355)
@@ -50,16 +52,36 @@ void check_sqlite_err(sqlite_api::sqlite3* conn, int res, char const* const errM
     }
 }
 
+// Check that the value of a pragma specified in the connection string
+// doesn't contain anything but a (possibly negative) number or a keyword.
+bool is_valid_pragma_value(std::string const& val)
+{
+    if (val.empty())
+        return false;
+
+    for (std::string::size_type n = 0; n != val.size(); ++n)
+    {
+        char const c = val[n];
+        if (!std::isalnum(static_cast<unsigned char>(c)) && !(n == 0 && c == '-'))
+            return false;
+    }
+
+    return true;
+}
+
 } // namespace anonymous
 
 
 sqlite3_session_backend::sqlite3_session_backend(
     connection_parameters const & parameters)
+    : bulkTransactions_(true)
+    , dateStorage_(date_as_text)
+    , statementCache_(16)
 {
     int timeout = 0;
     int connection_flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE;
     std::string vfs;
-    std::string synchronous;
+    std::vector<std::string> pragmas;
     std::string const & connectString = parameters.get_connect_string();
     std::string dbname(connectString);
     std::stringstream ssconn(connectString);
@@ -97,9 +119,16 @@ sqlite3_session_backend::sqlite3_session_backend(
             std::istringstream converter(val);
             converter >> timeout;
         }
-        else if ("synchronous" == key)
+        else if ("synchronous" == key || "journal_mode" == key ||
+                 "mmap_size" == key || "cache_size" == key)
         {
-            synchronous = val;
+            if (!is_valid_pragma_value(val))
+            {
+                throw soci_error("Invalid value \"" + val + "\" of \"" + key +
+                                 "\" option.");
+            }
+
+            pragmas.push_back(key + "=" + val);
         }
         else if ("readonly" == key)
         {
@@ -113,22 +142,82 @@ sqlite3_session_backend::sqlite3_session_backend(
         {
             vfs = val;
         }
+        else if ("statement_cache_size" == key)
+        {
+            std::istringstream converter(val);
+            int cacheSize = -1;
+            converter >> cacheSize;
+            if (!converter || cacheSize < 0)
+            {
+                throw soci_error("Invalid value of \"statement_cache_size\" "
+                                 "option, must be a non-negative integer.");
+            }
+
+            statementCache_.set_max_size(static_cast<std::size_t>(cacheSize));
+        }
+        else if ("date_storage" == key)
+        {
+            if ("text" == val)
+            {
+                dateStorage_ = date_as_text;
+            }
+            else if ("epoch_seconds" == val)
+            {
+                dateStorage_ = date_as_epoch_seconds;
+            }
+            else if ("epoch_microseconds" == val)
+            {
+                dateStorage_ = date_as_epoch_microseconds;
+            }
+            else
+            {
+                throw soci_error("Invalid value of \"date_storage\" option, "
+                                 "must be \"text\", \"epoch_seconds\" or "
+                                 "\"epoch_microseconds\".");
+            }
+        }
+        else if ("bulk_transactions" == key)
+        {
+            if ("true" == val)
+            {
+                bulkTransactions_ = true;
+            }
+            else if ("false" == val)
+            {
+                bulkTransactions_ = false;
+            }
+            else
+            {
+                throw soci_error("Invalid value of \"bulk_transactions\" "
+                                 "option, must be \"true\" or \"false\".");
+            }
+        }
 
     }
 
     int res = sqlite3_open_v2(dbname.c_str(), &conn_, connection_flags, (vfs.empty()?NULL:vfs.c_str()));
     check_sqlite_err(conn_, res, "Cannot establish connection to the database. ");
 
-    if (!synchronous.empty())
-    {
-        std::string const query("pragma synchronous=" + synchronous);
-        std::string const errMsg("Query failed: " + query);
-        execude_hardcoded(conn_, query.c_str(), errMsg.c_str());
-    }
-
+    // Set the timeout first as changing the journal mode may need to wait for
+    // the database lock.
     res = sqlite3_busy_timeout(conn_, timeout * 1000);
     check_sqlite_err(conn_, res, "Failed to set busy timeout for connection. ");
 
+    try
+    {
+        for (std::vector<std::string>::const_iterator it = pragmas.begin();
+             it != pragmas.end(); ++it)
+        {
+            std::string const query("pragma " + *it);
+            std::string const errMsg("Query failed: " + query);
+            execude_hardcoded(conn_, query.c_str(), errMsg.c_str());
+        }
+    }
+    catch (...)
+    {
+        sqlite3_close(conn_);
+        throw;
+    }
 }
 
 sqlite3_session_backend::~sqlite3_session_backend()
@@ -146,6 +235,12 @@ void sqlite3_session_backend::commit()
     execude_hardcoded(conn_, "COMMIT", "Cannot commit transaction.");
 }
 
+void sqlite3_session_backend::cancel()
+{
+    // This function is documented as being safe to call from any thread.
+    sqlite3_interrupt(conn_);
+}
+
 void sqlite3_session_backend::rollback()
 {
     execude_hardcoded(conn_, "ROLLBACK", "Cannot rollback transaction.");
@@ -161,6 +256,9 @@ bool sqlite3_session_backend::get_last_insert_id(
 
 void sqlite3_session_backend::clean_up()
 {
+    // All statements must be finalized before closing the connection.
+    statementCache_.clear();
+
     sqlite3_close(conn_);
 }
 
@@ -133,6 +133,16 @@ void sqlite3_standard_into_type_backend::post_fetch(bool gotData,
 
             case x_stdtm:
             {
+                // Integer values are interpreted as time since the epoch,
+                // whichever way the dates are stored by this session.
+                if (sqlite3_column_type(statement_.stmt_, pos) == SQLITE_INTEGER)
+                {
+                    epoch_to_tm(sqlite3_column_int64(statement_.stmt_, pos),
+                                statement_.session_.get_date_epoch_scale(),
+                                exchange_type_cast<x_stdtm>(data_));
+                    break;
+                }
+
                 const char *buf = reinterpret_cast<const char*>(
                     sqlite3_column_text(statement_.stmt_, pos)
                 );
@@ -12,6 +12,7 @@
 #include "soci/blob.h"
 #include "soci-dtocstr.h"
 #include "soci-exchange-cast.h"
+#include "common.h"
 // std
 #include <cstdio>
 #include <cstdlib>
@@ -139,9 +140,19 @@ void sqlite3_standard_use_type_backend::pre_use(indicator const * ind)
 
         case x_stdtm:
         {
+            std::tm &t = exchange_type_cast<x_stdtm>(data_);
+
+            sqlite3_session_backend const &session = statement_.session_;
+            if (session.dateStorage_ != sqlite3_session_backend::date_as_text)
+            {
+                col.type_ = dt_long_long;
+                col.int64_ = details::sqlite3::tm_to_epoch(
+                    t, session.get_date_epoch_scale());
+                break;
+            }
+
             col.type_ = dt_date;
             static const size_t bufSize = 20;
-            std::tm &t = exchange_type_cast<x_stdtm>(data_);
 
             col.buffer_.data_ = new char[bufSize];
             col.buffer_.size_
@@ -169,6 +180,11 @@ void sqlite3_standard_use_type_backend::pre_use(indicator const * ind)
             col.type_ = dt_blob;
             blob *b = static_cast<blob *>(data_);
             sqlite3_blob_backend *bbe = static_cast<sqlite3_blob_backend *>(b->get_backend());
+            if (bbe->is_open())
+            {
+                throw soci_error("Blob opened for incremental I/O can't be "
+                                 "used as a parameter.");
+            }
 
             col.buffer_.constData_ = bbe->get_buffer();
             col.buffer_.size_ = bbe->get_len();
@@ -207,7 +223,8 @@ void sqlite3_standard_use_type_backend::clean_up()
 
     sqlite3_column &col = statement_.useData_[0][position_ - 1];
 
-    if (col.isNull_ || !col.buffer_.data_)
+    // Dates stored as integers don't use the buffer.
+    if (col.isNull_ || col.type_ != dt_date || !col.buffer_.data_)
         return;
 
     delete[] col.buffer_.data_;
@@ -0,0 +1,103 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#define SOCI_SQLITE3_SOURCE
+#include "soci/sqlite3/soci-sqlite3.h"
+
+using namespace soci;
+using namespace sqlite_api;
+
+sqlite3_statement_cache::sqlite3_statement_cache(std::size_t maxSize)
+    : maxSize_(maxSize)
+{
+}
+
+sqlite3_statement_cache::~sqlite3_statement_cache()
+{
+    clear();
+}
+
+sqlite3_stmt *sqlite3_statement_cache::take(std::string const &query)
+{
+    index::iterator const it = index_.find(query);
+    if (it == index_.end())
+    {
+        ++stats_.misses;
+        return NULL;
+    }
+
+    ++stats_.hits;
+
+    sqlite3_stmt * const stmt = it->second->stmt;
+    lru_.erase(it->second);
+    index_.erase(it);
+
+    return stmt;
+}
+
+void sqlite3_statement_cache::put(std::string const &query, sqlite3_stmt *stmt)
+{
+    if (maxSize_ == 0)
+    {
+        sqlite3_finalize(stmt);
+        return;
+    }
+
+    // The result of sqlite3_reset() is the error of the last step, if any,
+    // which is irrelevant here: the statement itself remains usable.
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+
+    entry e;
+    e.query = query;
+    e.stmt = stmt;
+    lru_.push_front(e);
+    index_.insert(index::value_type(query, lru_.begin()));
+
+    while (lru_.size() > maxSize_)
+    {
+        evict_last();
+        ++stats_.evictions;
+    }
+}
+
+void sqlite3_statement_cache::evict_last()
+{
+    entries::iterator const last = --lru_.end();
+
+    std::pair<index::iterator, index::iterator> const
+        range = index_.equal_range(last->query);
+    for (index::iterator it = range.first; it != range.second; ++it)
+    {
+        if (it->second == last)
+        {
+            index_.erase(it);
+            break;
+        }
+    }
+
+    sqlite3_finalize(last->stmt);
+    lru_.erase(last);
+}
+
+void sqlite3_statement_cache::clear()
+{
+    while (!lru_.empty())
+    {
+        evict_last();
+    }
+}
+
+void sqlite3_statement_cache::set_max_size(std::size_t maxSize)
+{
+    maxSize_ = maxSize;
+
+    while (lru_.size() > maxSize_)
+    {
+        evict_last();
+    }
+}
@@ -7,6 +7,7 @@
 
 #define SOCI_SQLITE3_SOURCE
 #include "soci/sqlite3/soci-sqlite3.h"
+#include "soci-timer.h"
 // std
 #include <algorithm>
 #include <cctype>
@@ -39,9 +40,59 @@ sqlite3_statement_backend::sqlite3_statement_backend(
     , boundByName_(false)
     , boundByPos_(false)
     , rowsAffectedBulk_(-1LL)
+    , firstRowPrefetched_(false)
+    , prefetchResult_(SQLITE_OK)
+    , timeout_(0)
 {
 }
 
+namespace // anonymous
+{
+
+// Interrupts the statements executed during its lifetime if they take longer
+// than the given timeout, if it is non-zero.
+class timeout_guard
+{
+public:
+    timeout_guard(sqlite_api::sqlite3 *conn, int timeout)
+        : conn_(timeout ? conn : NULL), deadline_(0)
+    {
+        if (conn_)
+        {
+            deadline_ = monotonic_nanoseconds() + timeout * 1000000LL;
+
+            // The handler is called after approximately this number of
+            // virtual machine instructions, which is a small fraction of a
+            // millisecond.
+            sqlite3_progress_handler(conn_, 1000, check_deadline, this);
+        }
+    }
+
+    ~timeout_guard()
+    {
+        if (conn_)
+        {
+            sqlite3_progress_handler(conn_, 0, NULL, NULL);
+        }
+    }
+
+private:
+    static int check_deadline(void *data)
+    {
+        timeout_guard const * const guard = static_cast<timeout_guard *>(data);
+
+        // Returning non-zero interrupts the statement with SQLITE_INTERRUPT.
+        return monotonic_nanoseconds() > guard->deadline_;
+    }
+
+    sqlite_api::sqlite3 * const conn_;
+    long long deadline_;
+
+    SOCI_NOT_COPYABLE(timeout_guard)
+};
+
+} // namespace anonymous
+
 void sqlite3_statement_backend::alloc()
 {
     // ...
@@ -50,10 +101,11 @@ void sqlite3_statement_backend::alloc()
 void sqlite3_statement_backend::clean_up()
 {
     rowsAffectedBulk_ = -1LL;
+    firstRowPrefetched_ = false;
 
     if (stmt_)
     {
-        sqlite3_finalize(stmt_);
+        session_.statementCache_.put(query_, stmt_);
         stmt_ = 0;
         databaseReady_ = false;
     }
@@ -64,12 +116,33 @@ void sqlite3_statement_backend::prepare(std::string const & query,
 {
     clean_up();
 
+    query_ = query;
+
+    sqlite3_statement_cache & cache = session_.statementCache_;
+    stmt_ = cache.take(query);
+    if (stmt_)
+    {
+        databaseReady_ = true;
+        return;
+    }
+
     char const* tail = 0; // unused;
+#if SQLITE_VERSION_NUMBER >= 3020000
+    // Let SQLite know that the statement is going to be reused if it will be
+    // kept in the cache.
+    int const res = sqlite3_prepare_v3(session_.conn_,
+                              query.c_str(),
+                              static_cast<int>(query.size()),
+                              cache.get_max_size() ? SQLITE_PREPARE_PERSISTENT : 0,
+                              &stmt_,
+                              &tail);
+#else
     int const res = sqlite3_prepare_v2(session_.conn_,
                               query.c_str(),
                               static_cast<int>(query.size()),
                               &stmt_,
                               &tail);
+#endif
     if (res != SQLITE_OK)
     {
         char const* zErrMsg = sqlite3_errmsg(session_.conn_);
@@ -101,6 +174,79 @@ void sqlite3_statement_backend::reset()
     }
 }
 
+void sqlite3_rowset_arena::reset(int numCols)
+{
+    numRows_ = 0;
+    numCols_ = numCols;
+    bytesUsed_ = 0;
+}
+
+sqlite3_column* sqlite3_rowset_arena::add_row()
+{
+    std::size_t const end = static_cast<std::size_t>(numRows_ + 1) * numCols_;
+    if (cells_.size() < end)
+        cells_.resize(end);
+
+    return &cells_[static_cast<std::size_t>(numRows_++) * numCols_];
+}
+
+void sqlite3_rowset_arena::set_buffer(sqlite3_column& col,
+                                      void const* data, std::size_t size)
+{
+    // The pointer to the data can't be stored yet as the buffer may be
+    // reallocated when adding more data, it's set by finish().
+    col.buffer_.size_ = size;
+    col.buffer_.constData_ = NULL;
+
+    std::size_t const total = col.type_ == dt_blob ? size : size + 1;
+    if (bytes_.size() < bytesUsed_ + total)
+        bytes_.resize(std::max(bytesUsed_ + total, 2*bytes_.size()));
+
+    if (size)
+        memcpy(&bytes_[bytesUsed_], data, size);
+    if (total != size)
+        bytes_[bytesUsed_ + size] = '\0';
+
+    bytesUsed_ += total;
+}
+
+void sqlite3_rowset_arena::finish()
+{
+    if (bytesUsed_ == 0)
+        return;
+
+    // Assign the buffers in the same order as set_buffer() was called.
+    char* p = &bytes_[0];
+    std::size_t const numCells = static_cast<std::size_t>(numRows_) * numCols_;
+    for (std::size_t n = 0; n != numCells; ++n)
+    {
+        sqlite3_column& col = cells_[n];
+        if (col.isNull_)
+            continue;
+
+        switch (col.type_)
+        {
+            case dt_string:
+            case dt_date:
+                col.buffer_.data_ = p;
+                p += col.buffer_.size_ + 1;
+                break;
+
+            case dt_blob:
+                col.buffer_.data_ = p;
+                p += col.buffer_.size_;
+                break;
+
+            case dt_double:
+            case dt_integer:
+            case dt_long_long:
+            case dt_unsigned_long_long:
+            case dt_xml:
+                break;
+        }
+    }
+}
+
 // This is used by bulk operations
 statement_backend::exec_fetch_result
 sqlite3_statement_backend::load_rowset(int totalRows)
@@ -123,23 +269,17 @@ sqlite3_statement_backend::load_rowset(int totalRows)
         numCols = static_cast<int>(columns_.size());
 
 
+    dataCache_.reset(numCols);
+
     if (!databaseReady_)
     {
         retVal = ef_no_data;
     }
     else
     {
-        // make the vector big enough to hold the data we need
-        dataCache_.resize(totalRows);
-        for (sqlite3_recordset::iterator it = dataCache_.begin(),
-            end = dataCache_.end(); it != end; ++it)
-        {
-            (*it).resize(numCols);
-        }
-
         for (i = 0; i < totalRows && databaseReady_; ++i)
         {
-            int const res = sqlite3_step(stmt_);
+            int const res = step();
 
             if (SQLITE_DONE == res)
             {
@@ -149,10 +289,11 @@ sqlite3_statement_backend::load_rowset(int totalRows)
             }
             else if (SQLITE_ROW == res)
             {
+                sqlite3_column* const row = dataCache_.add_row();
                 for (int c = 0; c < numCols; ++c)
                 {
                     const sqlite3_column_info &coldef = columns_[c];
-                    sqlite3_column &col = dataCache_[i][c];
+                    sqlite3_column &col = row[c];
 
                     if (sqlite3_column_type(stmt_, c) == SQLITE_NULL)
                     {
@@ -163,13 +304,23 @@ sqlite3_statement_backend::load_rowset(int totalRows)
                     col.isNull_ = false;
                     col.type_ = coldef.type_;
 
+                    // Dates may be stored as time since the epoch.
+                    if (coldef.type_ == dt_date &&
+                            sqlite3_column_type(stmt_, c) == SQLITE_INTEGER)
+                    {
+                        col.type_ = dt_long_long;
+                        col.int64_ = sqlite3_column_int64(stmt_, c);
+                        continue;
+                    }
+
                     switch (coldef.type_)
                     {
                         case dt_string:
                         case dt_date:
-                            col.buffer_.size_ = sqlite3_column_bytes(stmt_, c);
-                            col.buffer_.data_ = new char[col.buffer_.size_+1];
-                            memcpy(col.buffer_.data_, sqlite3_column_text(stmt_, c), col.buffer_.size_+1);
+                            {
+                                const unsigned char* const text = sqlite3_column_text(stmt_, c);
+                                dataCache_.set_buffer(col, text, sqlite3_column_bytes(stmt_, c));
+                            }
                             break;
 
                         case dt_double:
@@ -186,9 +337,10 @@ sqlite3_statement_backend::load_rowset(int totalRows)
                             break;
 
                         case dt_blob:
-                            col.buffer_.size_ = sqlite3_column_bytes(stmt_, c);
-                            col.buffer_.data_ = (col.buffer_.size_ > 0 ? new char[col.buffer_.size_] : NULL);
-                            memcpy(col.buffer_.data_, sqlite3_column_blob(stmt_, c), col.buffer_.size_);
+                            {
+                                const void* const blob = sqlite3_column_blob(stmt_, c);
+                                dataCache_.set_buffer(col, blob, sqlite3_column_bytes(stmt_, c));
+                            }
                             break;
 
                         case dt_xml:
@@ -206,8 +358,8 @@ sqlite3_statement_backend::load_rowset(int totalRows)
             }
         }
     }
-    // if we read less than requested then shrink the vector
-    dataCache_.resize(i);
+
+    dataCache_.finish();
 
     return retVal;
 }
@@ -220,7 +372,7 @@ sqlite3_statement_backend::load_one()
         return ef_no_data;
 
     statement_backend::exec_fetch_result retVal = ef_success;
-    int const res = sqlite3_step(stmt_);
+    int const res = step();
 
     if (SQLITE_DONE == res)
     {
@@ -242,64 +394,202 @@ sqlite3_statement_backend::load_one()
     return retVal;
 }
 
-// Execute statements once for every row of useData
-statement_backend::exec_fetch_result
-sqlite3_statement_backend::bind_and_execute(int number)
+int sqlite3_statement_backend::step()
 {
-    statement_backend::exec_fetch_result retVal = ef_no_data;
+    if (firstRowPrefetched_)
+    {
+        firstRowPrefetched_ = false;
+        return prefetchResult_;
+    }
 
-    long long rowsAffectedBulkTemp = 0;
+    return sqlite3_step(stmt_);
+}
 
-    rowsAffectedBulk_ = -1;
+bool sqlite3_statement_backend::prefetch_first_row()
+{
+    if (firstRowPrefetched_)
+        return true;
 
-    int const rows = static_cast<int>(useData_.size());
-    for (int row = 0; row < rows; ++row)
-    {
-        sqlite3_reset(stmt_);
+    // The bulk operations need to bind each row separately, so we can't
+    // execute the statement in advance for them.
+    if (!vectorUses_.empty())
+        return false;
+
+    sqlite3_reset(stmt_);
+    bind_scalars();
 
-        int const totalPositions = static_cast<int>(useData_[0].size());
-        for (int pos = 1; pos <= totalPositions; ++pos)
+    timeout_guard guard(session_.conn_, timeout_);
+    prefetchResult_ = sqlite3_step(stmt_);
+    firstRowPrefetched_ = true;
+
+    return true;
+}
+
+// Bind the values of the scalar use elements, they remain bound when the
+// statement is reset, so this needs to be done only once per execution.
+void sqlite3_statement_backend::bind_scalars()
+{
+    if (useData_.empty())
+        return;
+
+    sqlite3_row const &row = useData_[0];
+    int const totalPositions = static_cast<int>(row.size());
+    for (int pos = 1; pos <= totalPositions; ++pos)
+    {
+        int bindRes = SQLITE_OK;
+        const sqlite3_column &col = row[pos-1];
+        if (col.isNull_)
         {
-            int bindRes = SQLITE_OK;
-            const sqlite3_column &col = useData_[row][pos-1];
-            if (col.isNull_)
-            {
-                bindRes = sqlite3_bind_null(stmt_, pos);
-            }
-            else
+            bindRes = sqlite3_bind_null(stmt_, pos);
+        }
+        else
+        {
+            switch (col.type_)
             {
-                switch (col.type_)
-                {
-                    case dt_string:
-                        bindRes = sqlite3_bind_text(stmt_, pos, col.buffer_.constData_, static_cast<int>(col.buffer_.size_), NULL);
-                        break;
+                case dt_string:
+                    bindRes = sqlite3_bind_text(stmt_, pos, col.buffer_.constData_, static_cast<int>(col.buffer_.size_), NULL);
+                    break;
 
-                    case dt_date:
-                        bindRes = sqlite3_bind_text(stmt_, pos, col.buffer_.constData_, static_cast<int>(col.buffer_.size_), SQLITE_TRANSIENT);
-                        break;
+                case dt_date:
+                    bindRes = sqlite3_bind_text(stmt_, pos, col.buffer_.constData_, static_cast<int>(col.buffer_.size_), SQLITE_TRANSIENT);
+                    break;
 
-                    case dt_double:
-                        bindRes = sqlite3_bind_double(stmt_, pos, col.double_);
-                        break;
+                case dt_double:
+                    bindRes = sqlite3_bind_double(stmt_, pos, col.double_);
+                    break;
 
-                    case dt_integer:
-                        bindRes = sqlite3_bind_int(stmt_, pos, col.int32_);
-                        break;
+                case dt_integer:
+                    bindRes = sqlite3_bind_int(stmt_, pos, col.int32_);
+                    break;
 
-                    case dt_long_long:
-                    case dt_unsigned_long_long:
-                        bindRes = sqlite3_bind_int64(stmt_, pos, col.int64_);
-                        break;
+                case dt_long_long:
+                case dt_unsigned_long_long:
+                    bindRes = sqlite3_bind_int64(stmt_, pos, col.int64_);
+                    break;
 
-                    case dt_blob:
-                        bindRes = sqlite3_bind_blob(stmt_, pos, col.buffer_.constData_, static_cast<int>(col.buffer_.size_), NULL);
-                        break;
+                case dt_blob:
+                    bindRes = sqlite3_bind_blob(stmt_, pos, col.buffer_.constData_, static_cast<int>(col.buffer_.size_), NULL);
+                    break;
 
-                    case dt_xml:
-                        throw soci_error("XML data type is not supported");
-                }
+                case dt_xml:
+                    throw soci_error("XML data type is not supported");
             }
+        }
+
+        if (SQLITE_OK != bindRes)
+        {
+            throw sqlite3_soci_error("Failure to bind on bulk operations", bindRes);
+        }
+    }
+}
+
+namespace // anonymous
+{
+
+// Executes a bulk operation inside a savepoint, which makes it atomic and,
+// when no transaction is active, avoids committing (and syncing the journal)
+// after each row as SAVEPOINT outside of a transaction starts a new one.
+//
+// The savepoint is rolled back, and the number of affected rows is reset,
+// unless release() is called.
+class bulk_savepoint
+{
+public:
+    bulk_savepoint(sqlite_api::sqlite3 *conn, long long &rowsAffected)
+        : conn_(conn), rowsAffected_(rowsAffected)
+    {
+        if (conn_)
+        {
+            exec("SAVEPOINT soci_bulk");
+        }
+    }
+
+    ~bulk_savepoint()
+    {
+        if (conn_)
+        {
+            // Don't let the timeout interrupt the rollback.
+            sqlite3_progress_handler(conn_, 0, NULL, NULL);
+
+            // Ignore the errors here: if SQLite had already rolled back the
+            // entire transaction because of the error, the savepoint doesn't
+            // exist any more, and there is nothing else we could do anyhow.
+            sqlite3_exec(conn_, "ROLLBACK TO soci_bulk", NULL, NULL, NULL);
+            sqlite3_exec(conn_, "RELEASE soci_bulk", NULL, NULL, NULL);
+
+            rowsAffected_ = 0;
+        }
+    }
+
+    // If releasing the savepoint fails, e.g. because committing the implicit
+    // transaction started by it failed, the dtor still rolls it back.
+    void release()
+    {
+        if (conn_)
+        {
+            exec("RELEASE soci_bulk");
+            conn_ = NULL;
+        }
+    }
+
+private:
+    void exec(char const *query)
+    {
+        int const res = sqlite3_exec(conn_, query, NULL, NULL, NULL);
+        if (res != SQLITE_OK)
+        {
+            std::ostringstream ss;
+            ss << "Failed to execute \"" << query << "\" for bulk operation: "
+               << sqlite3_errmsg(conn_);
+
+            throw sqlite3_soci_error(ss.str(), res);
+        }
+    }
+
+    sqlite_api::sqlite3 *conn_;
+    long long &rowsAffected_;
+
+    SOCI_NOT_COPYABLE(bulk_savepoint)
+};
+
+} // namespace anonymous
+
+// Execute statements once for every element of the vector use elements, if
+// any, or just once otherwise.
+statement_backend::exec_fetch_result
+sqlite3_statement_backend::bind_and_execute(int number)
+{
+    statement_backend::exec_fetch_result retVal = ef_no_data;
+
+    long long rowsAffectedBulkTemp = 0;
 
+    // No rows are affected if binding fails.
+    rowsAffectedBulk_ = 0;
+
+    sqlite3_reset(stmt_);
+    bind_scalars();
+
+    // Make get_affected_rows() below return the number of rows affected by
+    // the last step.
+    rowsAffectedBulk_ = -1;
+
+    // All vectors have the same size, which is checked by the core.
+    std::size_t const rows = vectorUses_.empty() ? 1 : vectorUses_[0]->size();
+
+    bulk_savepoint savepoint(rows > 1 && session_.bulkTransactions_
+                                ? session_.conn_
+                                : NULL,
+                             rowsAffectedBulk_);
+
+    for (std::size_t row = 0; row < rows; ++row)
+    {
+        if (row)
+            sqlite3_reset(stmt_);
+
+        for (std::vector<sqlite3_vector_use_type_backend *>::const_iterator
+                it = vectorUses_.begin(); it != vectorUses_.end(); ++it)
+        {
+            int const bindRes = (*it)->bind_element(row);
             if (SQLITE_OK != bindRes)
             {
                 // preserve the number of rows affected so far.
@@ -310,7 +600,7 @@ sqlite3_statement_backend::bind_and_execute(int number)
 
         // Handle the case where there are both into and use elements
         // in the same query and one of the into binds to a vector object.
-        if (1 == rows && number != rows)
+        if (1 == rows && number != 1)
         {
             return load_rowset(number);
         }
@@ -320,6 +610,8 @@ sqlite3_statement_backend::bind_and_execute(int number)
         rowsAffectedBulkTemp += get_affected_rows();
     }
 
+    savepoint.release();
+
     rowsAffectedBulk_ = rowsAffectedBulkTemp;
     return retVal;
 }
@@ -332,12 +624,33 @@ sqlite3_statement_backend::execute(int number)
         throw soci_error("No sqlite statement created");
     }
 
+    statement_backend::exec_fetch_result retVal = ef_no_data;
+
+    timeout_guard guard(session_.conn_, timeout_);
+
+    if (firstRowPrefetched_)
+    {
+        // The statement was already executed by describe_column() with all
+        // the parameters bound, just use its first row.
+        rowsAffectedBulk_ = -1;
+        databaseReady_ = true;
+
+        if (1 == number)
+        {
+            retVal = load_one();
+        }
+        else
+        {
+            retVal = load_rowset(number);
+        }
+
+        return retVal;
+    }
+
     sqlite3_reset(stmt_);
     databaseReady_ = true;
 
-    statement_backend::exec_fetch_result retVal = ef_no_data;
-
-    if (useData_.empty() == false)
+    if (useData_.empty() == false || vectorUses_.empty() == false)
     {
            retVal = bind_and_execute(number);
     }
@@ -359,6 +672,8 @@ sqlite3_statement_backend::execute(int number)
 statement_backend::exec_fetch_result
 sqlite3_statement_backend::fetch(int number)
 {
+    timeout_guard guard(session_.conn_, timeout_);
+
     if (number > 1)
         return load_rowset(number);
     else
@@ -409,6 +724,11 @@ std::string sqlite3_statement_backend::rewrite_for_procedure_call(
     return query;
 }
 
+void sqlite3_statement_backend::set_timeout(int milliseconds)
+{
+    timeout_ = milliseconds;
+}
+
 int sqlite3_statement_backend::prepare_for_describe()
 {
     return sqlite3_column_count(stmt_);
@@ -525,32 +845,40 @@ void sqlite3_statement_backend::describe_column(int colNum, data_type & type,
         return;
     }
 
-    // try to get it from the weak ass type system
-
-    // total hack - execute the statment once to get the column types
-    // then clear so it can be executed again
-    sqlite3_step(stmt_);
-
-    int const sqlite3_type = sqlite3_column_type(stmt_, colNum-1);
-    switch (sqlite3_type)
+    // The declared type is unknown, so try to determine the type from the
+    // value of this column in the first row. To avoid executing the query
+    // twice, the row retrieved here is kept and returned by the subsequent
+    // execute() call.
+    if (prefetch_first_row() && SQLITE_ROW == prefetchResult_)
     {
-    case SQLITE_INTEGER:
+        switch (sqlite3_column_type(stmt_, colNum-1))
+        {
+        case SQLITE_INTEGER:
+            coldef.type_ = type = dt_integer;
+            return;
+        case SQLITE_FLOAT:
+            coldef.type_ = type = dt_double;
+            return;
+        case SQLITE_BLOB:
+        case SQLITE_TEXT:
+            coldef.type_ = type = dt_string;
+            return;
+        }
+    }
+
+    // If there is no value to examine, use the rules similar to those used by
+    // SQLite itself for determining the column affinity from its declared
+    // type, but consider all the other types to be strings.
+    if (dt.find("int") != std::string::npos)
         type = dt_integer;
-        break;
-    case SQLITE_FLOAT:
+    else if (dt.find("real") != std::string::npos ||
+             dt.find("floa") != std::string::npos ||
+             dt.find("doub") != std::string::npos)
         type = dt_double;
-        break;
-    case SQLITE_BLOB:
-    case SQLITE_TEXT:
-        type = dt_string;
-        break;
-    default:
+    else
         type = dt_string;
-        break;
-    }
-    coldef.type_ = type;
 
-    sqlite3_reset(stmt_);
+    coldef.type_ = type;
 }
 
 sqlite3_standard_into_type_backend *
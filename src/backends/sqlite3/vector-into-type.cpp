@@ -132,7 +132,7 @@ void sqlite3_vector_into_type_backend::post_fetch(bool gotData, indicator * ind)
     int const endRow = static_cast<int>(statement_.dataCache_.size());
     for (int i = 0; i < endRow; ++i)
     {
-        sqlite3_column &col = statement_.dataCache_[i][position_-1];
+        sqlite3_column &col = statement_.dataCache_.get(i, position_-1);
 
         if (col.isNull_)
         {
@@ -197,7 +197,9 @@ void sqlite3_vector_into_type_backend::post_fetch(bool gotData, indicator * ind)
                     case dt_date:
                     case dt_string:
                     case dt_blob:
-                        set_in_vector(data_, i, std::string(col.buffer_.constData_, col.buffer_.size_));
+                        // Assign to the existing string to reuse its memory.
+                        (*static_cast<std::vector<std::string>*>(data_))[i]
+                            .assign(col.buffer_.constData_, col.buffer_.size_);
                         break;
 
                     case dt_double:
@@ -263,10 +265,22 @@ void sqlite3_vector_into_type_backend::post_fetch(bool gotData, indicator * ind)
                         break;
                     }
 
-                    case dt_double:
                     case dt_integer:
                     case dt_long_long:
                     case dt_unsigned_long_long:
+                    {
+                        // Integers are interpreted as time since the epoch.
+                        std::tm t;
+                        epoch_to_tm(col.type_ == dt_integer ? col.int32_
+                                                            : col.int64_,
+                                    statement_.session_.get_date_epoch_scale(),
+                                    t);
+
+                        set_in_vector(data_, i, t);
+                        break;
+                    }
+
+                    case dt_double:
                         throw soci_error("Into element used with non-convertible type.");
 
                     case dt_xml:
@@ -278,26 +292,6 @@ void sqlite3_vector_into_type_backend::post_fetch(bool gotData, indicator * ind)
             default:
                 throw soci_error("Into element used with non-supported type.");
         }
-
-        // cleanup data
-        switch (col.type_)
-        {
-            case dt_date:
-            case dt_string:
-            case dt_blob:
-                delete[] col.buffer_.data_;
-                col.buffer_.data_ = NULL;
-                break;
-
-            case dt_double:
-            case dt_integer:
-            case dt_long_long:
-            case dt_unsigned_long_long:
-                break;
-
-            case dt_xml:
-                throw soci_error("XML data type is not supported");
-        }
     }
 }
 
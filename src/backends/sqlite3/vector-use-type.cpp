@@ -12,6 +12,7 @@
 #include "soci-dtocstr.h"
 #include "common.h"
 // std
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -22,6 +23,85 @@
 using namespace soci;
 using namespace soci::details;
 using namespace soci::details::sqlite3;
+using namespace sqlite_api;
+
+namespace // anonymous
+{
+
+// Size of the buffer used for a single date formatted as a string.
+std::size_t const dateBufSize = 32;
+
+template <exchange_type e>
+typename exchange_type_traits<e>::value_type const &
+get_element(sqlite3_vector_use_type_backend const &be, std::size_t i)
+{
+    return (*static_cast<std::vector<typename exchange_type_traits<e>::value_type> *>(be.data_))[i];
+}
+
+// Binder functions for all the supported types: they use SQLITE_STATIC as
+// the data is bound directly from the user vectors (or dates_ buffer), which
+// are not modified until the statement is executed.
+
+int bind_char(sqlite3_vector_use_type_backend const &be, std::size_t i)
+{
+    return sqlite3_bind_text(be.statement_.stmt_, be.position_,
+                             &get_element<x_char>(be, i), 1, SQLITE_STATIC);
+}
+
+int bind_stdstring(sqlite3_vector_use_type_backend const &be, std::size_t i)
+{
+    std::string const &s = get_element<x_stdstring>(be, i);
+    return sqlite3_bind_text(be.statement_.stmt_, be.position_,
+                             s.c_str(), static_cast<int>(s.size()),
+                             SQLITE_STATIC);
+}
+
+int bind_short(sqlite3_vector_use_type_backend const &be, std::size_t i)
+{
+    return sqlite3_bind_int(be.statement_.stmt_, be.position_,
+                            get_element<x_short>(be, i));
+}
+
+int bind_integer(sqlite3_vector_use_type_backend const &be, std::size_t i)
+{
+    return sqlite3_bind_int(be.statement_.stmt_, be.position_,
+                            get_element<x_integer>(be, i));
+}
+
+int bind_long_long(sqlite3_vector_use_type_backend const &be, std::size_t i)
+{
+    return sqlite3_bind_int64(be.statement_.stmt_, be.position_,
+                              get_element<x_long_long>(be, i));
+}
+
+int bind_unsigned_long_long(sqlite3_vector_use_type_backend const &be,
+                            std::size_t i)
+{
+    return sqlite3_bind_int64(be.statement_.stmt_, be.position_,
+        static_cast<sqlite3_int64>(get_element<x_unsigned_long_long>(be, i)));
+}
+
+int bind_double(sqlite3_vector_use_type_backend const &be, std::size_t i)
+{
+    return sqlite3_bind_double(be.statement_.stmt_, be.position_,
+                               get_element<x_double>(be, i));
+}
+
+int bind_stdtm(sqlite3_vector_use_type_backend const &be, std::size_t i)
+{
+    return sqlite3_bind_text(be.statement_.stmt_, be.position_,
+                             &be.dates_[i * dateBufSize], -1, SQLITE_STATIC);
+}
+
+int bind_stdtm_as_epoch(sqlite3_vector_use_type_backend const &be,
+                        std::size_t i)
+{
+    return sqlite3_bind_int64(be.statement_.stmt_, be.position_,
+        tm_to_epoch(get_element<x_stdtm>(be, i),
+                    be.statement_.session_.get_date_epoch_scale()));
+}
+
+} // namespace anonymous
 
 void sqlite3_vector_use_type_backend::bind_by_pos(int & position,
                                             void * data,
@@ -38,6 +118,10 @@ void sqlite3_vector_use_type_backend::bind_by_pos(int & position,
     position_ = position++;
 
     statement_.boundByPos_ = true;
+
+    if (std::find(statement_.vectorUses_.begin(), statement_.vectorUses_.end(),
+                  this) == statement_.vectorUses_.end())
+        statement_.vectorUses_.push_back(this);
 }
 
 void sqlite3_vector_use_type_backend::bind_by_name(std::string const & name,
@@ -64,100 +148,98 @@ void sqlite3_vector_use_type_backend::bind_by_name(std::string const & name,
         throw soci_error(ss.str());
     }
     statement_.boundByName_ = true;
+
+    if (std::find(statement_.vectorUses_.begin(), statement_.vectorUses_.end(),
+                  this) == statement_.vectorUses_.end())
+        statement_.vectorUses_.push_back(this);
 }
 
 void sqlite3_vector_use_type_backend::pre_use(indicator const * ind)
 {
-    std::size_t const vsize = size();
+    ind_ = ind;
 
-    // make sure that useData can hold enough rows
-    if (statement_.useData_.size() != vsize)
-        statement_.useData_.resize(vsize);
+    switch (type_)
+    {
+        case x_char:
+            binder_ = &bind_char;
+            break;
 
-    int const pos = position_ - 1;
+        case x_stdstring:
+            binder_ = &bind_stdstring;
+            break;
 
-    for (size_t i = 0; i != vsize; ++i)
-    {
-        // make sure that each row can accomodate the number of columns
-        if (statement_.useData_[i].size() < static_cast<std::size_t>(position_))
-            statement_.useData_[i].resize(position_);
+        case x_short:
+            binder_ = &bind_short;
+            break;
 
-        sqlite3_column &col = statement_.useData_[i][pos];
+        case x_integer:
+            binder_ = &bind_integer;
+            break;
 
-        // the data in vector can be either i_ok or i_null
-        if (ind != NULL && ind[i] == i_null)
-        {
-            col.isNull_ = true;
-            col.buffer_.data_ = NULL;
-            continue;
-        }
+        case x_long_long:
+            binder_ = &bind_long_long;
+            break;
 
-        col.isNull_ = false;
+        case x_unsigned_long_long:
+            binder_ = &bind_unsigned_long_long;
+            break;
 
-        switch (type_)
-        {
-            case x_char:
-                col.type_ = dt_string;
-                col.buffer_.constData_ = &(*static_cast<std::vector<exchange_type_traits<x_char>::value_type> *>(data_))[i];
-                col.buffer_.size_ = 1;
-                break;
+        case x_double:
+            binder_ = &bind_double;
+            break;
 
-            case x_stdstring:
+        case x_stdtm:
+        {
+            if (statement_.session_.dateStorage_ !=
+                    sqlite3_session_backend::date_as_text)
             {
-                std::string &s = (*static_cast<std::vector<exchange_type_traits<x_stdstring>::value_type> *>(data_))[i];
-                col.type_ = dt_string;
-                col.buffer_.constData_ = s.c_str();
-                col.buffer_.size_ = s.size();
+                // No need to format anything in this case.
+                binder_ = &bind_stdtm_as_epoch;
                 break;
             }
 
-            case x_short:
-                col.type_ = dt_integer;
-                col.int32_ = (*static_cast<std::vector<exchange_type_traits<x_short>::value_type> *>(data_))[i];
-                break;
-
-            case x_integer:
-                col.type_ = dt_integer;
-                col.int32_ = (*static_cast<std::vector<exchange_type_traits<x_integer>::value_type> *>(data_))[i];
-                break;
+            binder_ = &bind_stdtm;
 
-            case x_long_long:
-                col.type_ = dt_long_long;
-                col.int64_ = (*static_cast<std::vector<exchange_type_traits<x_long_long>::value_type> *>(data_))[i];
-                break;
+            // SQLite doesn't have any date type, so dates must be formatted
+            // as strings: do it for all elements at once in a buffer reused
+            // by the subsequent executions.
+            std::vector<std::tm> const &v
+                = *static_cast<std::vector<std::tm> *>(data_);
+            std::size_t const vsize = v.size();
+            if (dates_.size() < vsize * dateBufSize)
+                dates_.resize(vsize * dateBufSize);
 
-            case x_unsigned_long_long:
-                col.type_ = dt_long_long;
-                col.int64_ = (*static_cast<std::vector<exchange_type_traits<x_unsigned_long_long>::value_type> *>(data_))[i];
-                break;
-
-            case x_double:
-                col.type_ = dt_double;
-                col.double_ = (*static_cast<std::vector<exchange_type_traits<x_double>::value_type> *>(data_))[i];
-                break;
-
-            case x_stdtm:
+            for (std::size_t i = 0; i != vsize; ++i)
             {
-                std::tm &tm = (*static_cast<std::vector<exchange_type_traits<x_stdtm>::value_type> *>(data_))[i];
-                static const size_t bufSize = 20;
-
-                col.type_ = dt_date;
-                col.buffer_.data_ = new char[bufSize];
-                col.buffer_.size_
-                    = snprintf(col.buffer_.data_, bufSize, "%d-%02d-%02d %02d:%02d:%02d",
-                        tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday,
-                        tm.tm_hour, tm.tm_min, tm.tm_sec
-                    );
-                break;
+                if (ind != NULL && ind[i] == i_null)
+                    continue;
+
+                std::tm const &tm = v[i];
+                int const len = snprintf(&dates_[i * dateBufSize], dateBufSize,
+                    "%d-%02d-%02d %02d:%02d:%02d",
+                    tm.tm_year + 1900, tm.tm_mon + 1, tm.tm_mday,
+                    tm.tm_hour, tm.tm_min, tm.tm_sec);
+                if (len < 0 || static_cast<std::size_t>(len) >= dateBufSize)
+                    throw soci_error("Invalid date in use vector element.");
             }
-
-            default:
-                throw soci_error(
-                    "Use vector element used with non-supported type.");
+            break;
         }
+
+        default:
+            throw soci_error(
+                "Use vector element used with non-supported type.");
     }
 }
 
+int sqlite3_vector_use_type_backend::bind_element(std::size_t i) const
+{
+    // the data in vector can be either i_ok or i_null
+    if (ind_ != NULL && ind_[i] == i_null)
+        return sqlite3_bind_null(statement_.stmt_, position_);
+
+    return binder_(*this, i);
+}
+
 std::size_t sqlite3_vector_use_type_backend::size()
 {
     std::size_t sz SOCI_DUMMY_INIT(0);
@@ -197,19 +279,6 @@ std::size_t sqlite3_vector_use_type_backend::size()
 
 void sqlite3_vector_use_type_backend::clean_up()
 {
-    if (type_ != x_stdtm)
-        return;
-
-    int const pos = position_ - 1;
-
-    for (sqlite3_recordset::iterator iter = statement_.useData_.begin(), last = statement_.useData_.end();
-        iter != last; ++iter)
-    {
-        sqlite3_column &col = (*iter)[pos];
-
-        if (col.isNull_)
-            continue;
-
-        delete[] col.buffer_.data_;
-    }
+    std::vector<sqlite3_vector_use_type_backend *> &uses = statement_.vectorUses_;
+    uses.erase(std::remove(uses.begin(), uses.end(), this), uses.end());
 }
@@ -0,0 +1,69 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#define SOCI_SQLITE3_SOURCE
+#include "soci/sqlite3/soci-sqlite3.h"
+#include "soci/session.h"
+
+using namespace soci;
+using namespace sqlite_api;
+
+namespace // anonymous
+{
+
+// Default settings used for all the sessions of the pool: 256MiB of
+// memory-mapped I/O and 16MiB of page cache (negative value means KiB).
+char const* const defaultOptions = "mmap_size=268435456 cache_size=-16384 ";
+
+// Callback for sqlite3_exec() storing the first column of the result.
+int store_result(void* data, int columns, char** values, char** /* names */)
+{
+    if (columns > 0 && values[0])
+        *static_cast<std::string*>(data) = values[0];
+
+    return 0;
+}
+
+} // namespace anonymous
+
+sqlite3_wal_pool::sqlite3_wal_pool(std::string const & connectString,
+                                   std::size_t readers)
+    : writer_(1), readers_(readers)
+{
+    // Allow using just the file name, as with the normal sessions.
+    std::string options(defaultOptions);
+    if (connectString.find('=') == std::string::npos)
+        options += "db=\"" + connectString + "\"";
+    else
+        options += connectString;
+
+    // Open the writer first, so that the database is created, if necessary,
+    // and switched to WAL mode before any readers are opened.
+    session & writer = writer_.at(0);
+    writer.open(*factory_sqlite3(), options + " journal_mode=wal");
+
+    std::string mode;
+    sqlite_api::sqlite3 * const conn =
+        static_cast<sqlite3_session_backend *>(writer.get_backend())->conn_;
+    int const res = sqlite3_exec(conn, "pragma journal_mode",
+                                 &store_result, &mode, NULL);
+    if (res != SQLITE_OK)
+    {
+        throw sqlite3_soci_error("Failed to query the journal mode.", res);
+    }
+
+    if (mode != "wal")
+    {
+        throw soci_error("WAL journal mode couldn't be enabled for the "
+                         "database, current mode is \"" + mode + "\".");
+    }
+
+    for (std::size_t i = 0; i != readers; ++i)
+    {
+        readers_.at(i).open(*factory_sqlite3(), options + " readonly=true");
+    }
+}
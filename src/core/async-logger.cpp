@@ -0,0 +1,565 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#define SOCI_SOURCE
+#include "soci/async-logger.h"
+#include "soci/error.h"
+#include "soci-mutex.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+
+typedef CONDITION_VARIABLE soci_cond_t;
+typedef HANDLE soci_thread_t;
+
+#define COND_INIT(x) InitializeConditionVariable(x)
+#define COND_DEST(x)
+#define COND_SIGNAL(x) WakeConditionVariable(x)
+#define COND_BROADCAST(x) WakeAllConditionVariable(x)
+
+#else
+
+#include <time.h>
+
+typedef pthread_cond_t soci_cond_t;
+typedef pthread_t soci_thread_t;
+
+#define COND_INIT(x) pthread_cond_init(x, NULL)
+#define COND_DEST(x) pthread_cond_destroy(x)
+#define COND_SIGNAL(x) pthread_cond_signal(x)
+#define COND_BROADCAST(x) pthread_cond_broadcast(x)
+
+#endif
+
+using namespace soci;
+using namespace soci::details;
+
+namespace // anonymous
+{
+
+// The producers never take any lock, so the positions in the ring buffer and
+// the counters are manipulated using atomic operations only.
+typedef long long soci_atomic_t;
+
+#if defined(__GNUC__)
+
+inline soci_atomic_t atomic_load(soci_atomic_t const * p)
+{
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+inline void atomic_store(soci_atomic_t * p, soci_atomic_t value)
+{
+    __atomic_store_n(p, value, __ATOMIC_RELEASE);
+}
+
+inline bool atomic_cas(soci_atomic_t * p, soci_atomic_t expected,
+    soci_atomic_t desired)
+{
+    return __atomic_compare_exchange_n(p, &expected, desired, false,
+        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+inline void atomic_add(soci_atomic_t * p, soci_atomic_t value)
+{
+    __atomic_fetch_add(p, value, __ATOMIC_RELAXED);
+}
+
+#elif defined(_WIN32)
+
+inline soci_atomic_t atomic_load(soci_atomic_t const * p)
+{
+    return InterlockedCompareExchange64(const_cast<soci_atomic_t *>(p), 0, 0);
+}
+
+inline void atomic_store(soci_atomic_t * p, soci_atomic_t value)
+{
+    InterlockedExchange64(p, value);
+}
+
+inline bool atomic_cas(soci_atomic_t * p, soci_atomic_t expected,
+    soci_atomic_t desired)
+{
+    return InterlockedCompareExchange64(p, desired, expected) == expected;
+}
+
+inline void atomic_add(soci_atomic_t * p, soci_atomic_t value)
+{
+    InterlockedExchangeAdd64(p, value);
+}
+
+#else
+#error "Atomic operations are not implemented for this compiler."
+#endif
+
+// How long the background thread sleeps, in milliseconds, when there is
+// nothing to write: producers wake it up only if it is known to be waiting,
+// which is racy, so this also bounds the delay of a missed wake up.
+int const idle_wait_ms = 50;
+
+void timed_wait(soci_cond_t * cond, soci_mutex_t * mutex, int ms)
+{
+#ifdef _WIN32
+    SleepConditionVariableCS(cond, mutex, ms);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_sec += ms / 1000;
+    ts.tv_nsec += (ms % 1000) * 1000000L;
+    if (ts.tv_nsec >= 1000000000L)
+    {
+        ts.tv_sec += 1;
+        ts.tv_nsec -= 1000000000L;
+    }
+
+    pthread_cond_timedwait(cond, mutex, &ts);
+#endif
+}
+
+std::size_t round_up_to_power_of_two(std::size_t n)
+{
+    std::size_t result = 2;
+    while (result < n)
+    {
+        result <<= 1;
+    }
+
+    return result;
+}
+
+} // namespace anonymous
+
+// The object shared by all copies of async_logger_impl.
+//
+// This is a bounded multi-producer single-consumer queue: each slot has a
+// sequence number which tells whether it is free for the producer with the
+// given position or contains data for the consumer, so that producers only
+// need to atomically reserve a position to get exclusive access to a slot.
+class async_logger_impl::async_log_queue
+{
+public:
+    async_log_queue(std::size_t capacity, std::size_t maxQueryLength)
+        : mask_(round_up_to_power_of_two(capacity) - 1),
+          maxQueryLength_(maxQueryLength),
+          slots_(mask_ + 1),
+          text_((mask_ + 1) * maxQueryLength),
+          enqueuePos_(0),
+          dequeuePos_(0),
+          logged_(0),
+          dropped_(0),
+          truncated_(0),
+          hasStream_(0),
+          consumerWaiting_(0),
+          refCount_(1),
+          stream_(NULL),
+          stop_(false)
+    {
+        if (maxQueryLength == 0)
+        {
+            throw soci_error("Maximal query length must be positive.");
+        }
+
+        for (std::size_t i = 0; i != slots_.size(); ++i)
+        {
+            slots_[i].sequence_ = static_cast<soci_atomic_t>(i);
+            slots_[i].length_ = 0;
+        }
+
+        MUTEX_INIT(&mutex_);
+        COND_INIT(&wakeCond_);
+        COND_INIT(&drainedCond_);
+
+        start_thread();
+    }
+
+    ~async_log_queue()
+    {
+        {
+            scoped_lock lock(&mutex_);
+            stop_ = true;
+            COND_SIGNAL(&wakeCond_);
+        }
+
+        join_thread();
+
+        COND_DEST(&drainedCond_);
+        COND_DEST(&wakeCond_);
+        MUTEX_DEST(&mutex_);
+    }
+
+    void open_file(std::string const & fileName)
+    {
+        file_.open(fileName.c_str(), std::ios::out | std::ios::app);
+        if (!file_)
+        {
+            throw soci_error("Failed to open the log file \"" + fileName + "\".");
+        }
+
+        set_stream(&file_);
+    }
+
+    void add_ref()
+    {
+        atomic_add(&refCount_, 1);
+    }
+
+    // Returns true if this was the last reference.
+    bool release()
+    {
+        for (;;)
+        {
+            soci_atomic_t const count = atomic_load(&refCount_);
+            if (atomic_cas(&refCount_, count, count - 1))
+            {
+                return count == 1;
+            }
+        }
+    }
+
+    bool has_stream() const
+    {
+        return atomic_load(&hasStream_) != 0;
+    }
+
+    // Called by the producers, never blocks.
+    void push(std::string const & query)
+    {
+        soci_atomic_t pos = atomic_load(&enqueuePos_);
+        slot * s;
+        for (;;)
+        {
+            s = &slots_[static_cast<std::size_t>(pos) & mask_];
+            soci_atomic_t const diff = atomic_load(&s->sequence_) - pos;
+            if (diff == 0)
+            {
+                if (atomic_cas(&enqueuePos_, pos, pos + 1))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // The slot still contains the data written one full cycle
+                // ago, i.e. the buffer is full.
+                atomic_add(&dropped_, 1);
+                return;
+            }
+
+            pos = atomic_load(&enqueuePos_);
+        }
+
+        std::size_t length = query.size();
+        if (length > maxQueryLength_)
+        {
+            length = maxQueryLength_;
+            atomic_add(&truncated_, 1);
+        }
+
+        char * const text = &text_[(static_cast<std::size_t>(pos) & mask_)
+                                   * maxQueryLength_];
+        query.copy(text, length);
+        s->length_ = length;
+
+        atomic_store(&s->sequence_, pos + 1);
+
+        if (atomic_load(&consumerWaiting_))
+        {
+            COND_SIGNAL(&wakeCond_);
+        }
+    }
+
+    void set_stream(std::ostream * s)
+    {
+        flush();
+
+        scoped_lock lock(&mutex_);
+        stream_ = s;
+        atomic_store(&hasStream_, s ? 1 : 0);
+    }
+
+    std::ostream * get_stream()
+    {
+        scoped_lock lock(&mutex_);
+        return stream_;
+    }
+
+    void flush()
+    {
+        soci_atomic_t const target = atomic_load(&enqueuePos_);
+
+        scoped_lock lock(&mutex_);
+        while (atomic_load(&dequeuePos_) < target && !stop_)
+        {
+            COND_SIGNAL(&wakeCond_);
+            timed_wait(&drainedCond_, &mutex_, idle_wait_ms);
+        }
+
+        if (stream_)
+        {
+            stream_->flush();
+        }
+    }
+
+    unsigned long long get_logged_count() const
+    {
+        return static_cast<unsigned long long>(atomic_load(&logged_));
+    }
+
+    unsigned long long get_dropped_count() const
+    {
+        return static_cast<unsigned long long>(atomic_load(&dropped_));
+    }
+
+    unsigned long long get_truncated_count() const
+    {
+        return static_cast<unsigned long long>(atomic_load(&truncated_));
+    }
+
+private:
+    struct slot
+    {
+        soci_atomic_t sequence_;
+        std::size_t length_;
+    };
+
+    bool has_pending()
+    {
+        slot & s = slots_[static_cast<std::size_t>(dequeuePos_) & mask_];
+        return atomic_load(&s.sequence_) == dequeuePos_ + 1;
+    }
+
+    // Move all the available queries into the provided buffer, return their
+    // number.
+    std::size_t pop_all(std::string & batch)
+    {
+        std::size_t count = 0;
+        soci_atomic_t pos = dequeuePos_;
+        for (;;)
+        {
+            slot & s = slots_[static_cast<std::size_t>(pos) & mask_];
+            if (atomic_load(&s.sequence_) != pos + 1)
+            {
+                break;
+            }
+
+            batch.append(&text_[(static_cast<std::size_t>(pos) & mask_)
+                                * maxQueryLength_], s.length_);
+            batch += '\n';
+
+            // Make the slot available to the producers for the next cycle.
+            atomic_store(&s.sequence_,
+                pos + static_cast<soci_atomic_t>(mask_ + 1));
+
+            ++pos;
+            ++count;
+        }
+
+        return count;
+    }
+
+    void run()
+    {
+        std::string batch;
+        for (;;)
+        {
+            batch.clear();
+            std::size_t const count = pop_all(batch);
+
+            scoped_lock lock(&mutex_);
+
+            if (count != 0)
+            {
+                if (stream_)
+                {
+                    stream_->write(batch.data(),
+                        static_cast<std::streamsize>(batch.size()));
+                    stream_->flush();
+
+                    atomic_add(&logged_, static_cast<soci_atomic_t>(count));
+                }
+
+                atomic_store(&dequeuePos_,
+                    dequeuePos_ + static_cast<soci_atomic_t>(count));
+                COND_BROADCAST(&drainedCond_);
+
+                continue;
+            }
+
+            if (stop_)
+            {
+                break;
+            }
+
+            atomic_store(&consumerWaiting_, 1);
+            if (!has_pending())
+            {
+                timed_wait(&wakeCond_, &mutex_, idle_wait_ms);
+            }
+            atomic_store(&consumerWaiting_, 0);
+        }
+    }
+
+#ifdef _WIN32
+    static DWORD WINAPI thread_func(LPVOID arg)
+    {
+        static_cast<async_log_queue *>(arg)->run();
+        return 0;
+    }
+
+    void start_thread()
+    {
+        thread_ = CreateThread(NULL, 0, thread_func, this, 0, NULL);
+        if (thread_ == NULL)
+        {
+            throw soci_error("Failed to create the logging thread.");
+        }
+    }
+
+    void join_thread()
+    {
+        WaitForSingleObject(thread_, INFINITE);
+        CloseHandle(thread_);
+    }
+#else
+    static void * thread_func(void * arg)
+    {
+        static_cast<async_log_queue *>(arg)->run();
+        return NULL;
+    }
+
+    void start_thread()
+    {
+        if (pthread_create(&thread_, NULL, thread_func, this) != 0)
+        {
+            throw soci_error("Failed to create the logging thread.");
+        }
+    }
+
+    void join_thread()
+    {
+        pthread_join(thread_, NULL);
+    }
+#endif
+
+    std::size_t const mask_;
+    std::size_t const maxQueryLength_;
+
+    std::vector<slot> slots_;
+    std::vector<char> text_;
+
+    soci_atomic_t enqueuePos_;
+    soci_atomic_t dequeuePos_;
+
+    soci_atomic_t logged_;
+    soci_atomic_t dropped_;
+    soci_atomic_t truncated_;
+
+    soci_atomic_t hasStream_;
+    soci_atomic_t consumerWaiting_;
+    soci_atomic_t refCount_;
+
+    // These fields are protected by mutex_.
+    std::ostream * stream_;
+    bool stop_;
+
+    std::ofstream file_;
+
+    soci_mutex_t mutex_;
+    soci_cond_t wakeCond_;
+    soci_cond_t drainedCond_;
+    soci_thread_t thread_;
+
+    SOCI_NOT_COPYABLE(async_log_queue)
+};
+
+async_logger_impl::async_logger_impl(std::size_t capacity,
+    std::size_t maxQueryLength)
+    : queue_(new async_log_queue(capacity, maxQueryLength))
+{
+}
+
+async_logger_impl::async_logger_impl(std::string const & fileName,
+    std::size_t capacity, std::size_t maxQueryLength)
+    : queue_(new async_log_queue(capacity, maxQueryLength))
+{
+    try
+    {
+        queue_->open_file(fileName);
+    }
+    catch (...)
+    {
+        delete queue_;
+        throw;
+    }
+}
+
+async_logger_impl::async_logger_impl(async_log_queue * queue)
+    : queue_(queue)
+{
+    queue_->add_ref();
+}
+
+async_logger_impl::~async_logger_impl()
+{
+    if (queue_->release())
+    {
+        delete queue_;
+    }
+}
+
+void async_logger_impl::start_query(std::string const & query)
+{
+    if (queue_->has_stream())
+    {
+        queue_->push(query);
+    }
+
+    lastQuery_ = query;
+}
+
+void async_logger_impl::set_stream(std::ostream * s)
+{
+    queue_->set_stream(s);
+}
+
+std::ostream * async_logger_impl::get_stream() const
+{
+    return queue_->get_stream();
+}
+
+std::string async_logger_impl::get_last_query() const
+{
+    return lastQuery_;
+}
+
+void async_logger_impl::flush()
+{
+    queue_->flush();
+}
+
+unsigned long long async_logger_impl::get_logged_count() const
+{
+    return queue_->get_logged_count();
+}
+
+unsigned long long async_logger_impl::get_dropped_count() const
+{
+    return queue_->get_dropped_count();
+}
+
+unsigned long long async_logger_impl::get_truncated_count() const
+{
+    return queue_->get_truncated_count();
+}
+
+logger_impl * async_logger_impl::do_clone() const
+{
+    return new async_logger_impl(queue_);
+}
@@ -0,0 +1,346 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#define SOCI_SOURCE
+#include "soci/async-result.h"
+#include "soci/statement.h"
+#include "soci/session.h"
+#include "soci/error.h"
+#include "soci-async-operation.h"
+#include "soci-mutex.h"
+
+#include <algorithm>
+#include <exception>
+#include <string>
+
+#ifdef _WIN32
+typedef HANDLE soci_thread_t;
+#else
+typedef pthread_t soci_thread_t;
+#endif
+
+using namespace soci;
+using namespace soci::details;
+
+namespace // anonymous
+{
+
+// Exception thrown from get() if the operation failed in the worker thread:
+// exceptions can't be transported between threads in C++98, so only the
+// message and the category of the original one are preserved.
+class async_soci_error : public soci_error
+{
+public:
+    async_soci_error(std::string const & msg, error_category category)
+        : soci_error(msg), category_(category)
+    {
+    }
+
+    error_category get_error_category() const SOCI_OVERRIDE
+    {
+        return category_;
+    }
+
+private:
+    error_category category_;
+};
+
+} // namespace anonymous
+
+class async_operation::worker
+{
+public:
+    worker(statement_backend & backend, kind k, int num)
+        : backend_(backend), kind_(k), num_(num),
+          res_(statement_backend::ef_no_data),
+          failed_(false), category_(soci_error::unknown),
+          finished_(false), joined_(false)
+    {
+        MUTEX_INIT(&mutex_);
+
+        try
+        {
+            start_thread();
+        }
+        catch (...)
+        {
+            MUTEX_DEST(&mutex_);
+            throw;
+        }
+    }
+
+    ~worker()
+    {
+        if (!joined_)
+            join_thread();
+
+        MUTEX_DEST(&mutex_);
+    }
+
+    bool is_finished()
+    {
+        scoped_lock lock(&mutex_);
+        return finished_;
+    }
+
+    // Wait for the thread to terminate and return its result or throw.
+    statement_backend::exec_fetch_result wait()
+    {
+        if (!joined_)
+        {
+            join_thread();
+            joined_ = true;
+        }
+
+        if (failed_)
+            throw async_soci_error(message_, category_);
+
+        return res_;
+    }
+
+private:
+    void run()
+    {
+        try
+        {
+            res_ = kind_ == op_execute ? backend_.execute(num_)
+                                       : backend_.fetch(num_);
+        }
+        catch (soci_error const & e)
+        {
+            failed_ = true;
+            message_ = e.get_error_message();
+            category_ = e.get_error_category();
+        }
+        catch (std::exception const & e)
+        {
+            failed_ = true;
+            message_ = e.what();
+        }
+        catch (...)
+        {
+            failed_ = true;
+            message_ = "Unknown error.";
+        }
+
+        scoped_lock lock(&mutex_);
+        finished_ = true;
+    }
+
+#ifdef _WIN32
+    static DWORD WINAPI thread_func(LPVOID arg)
+    {
+        static_cast<worker *>(arg)->run();
+        return 0;
+    }
+
+    void start_thread()
+    {
+        thread_ = CreateThread(NULL, 0, thread_func, this, 0, NULL);
+        if (thread_ == NULL)
+        {
+            throw soci_error("Failed to create the asynchronous operation thread.");
+        }
+    }
+
+    void join_thread()
+    {
+        WaitForSingleObject(thread_, INFINITE);
+        CloseHandle(thread_);
+    }
+#else
+    static void * thread_func(void * arg)
+    {
+        static_cast<worker *>(arg)->run();
+        return NULL;
+    }
+
+    void start_thread()
+    {
+        if (pthread_create(&thread_, NULL, thread_func, this) != 0)
+        {
+            throw soci_error("Failed to create the asynchronous operation thread.");
+        }
+    }
+
+    void join_thread()
+    {
+        pthread_join(thread_, NULL);
+    }
+#endif
+
+    statement_backend & backend_;
+    kind const kind_;
+    int const num_;
+
+    // These fields are only written by the worker thread and only read after
+    // joining it.
+    statement_backend::exec_fetch_result res_;
+    bool failed_;
+    std::string message_;
+    soci_error::error_category category_;
+
+    // Protected by the mutex as it's polled while the thread is running.
+    bool finished_;
+
+    bool joined_;
+
+    soci_mutex_t mutex_;
+    soci_thread_t thread_;
+
+    SOCI_NOT_COPYABLE(worker)
+};
+
+async_operation::async_operation(statement_impl & st, kind k, int num,
+                                 long long startTime, bool * gotData)
+    : st_(st), kind_(k), num_(num), startTime_(startTime), gotData_(gotData),
+      refCount_(1), done_(false), worker_(NULL)
+{
+    // There is nothing to do when fetching if start_fetch() returned 0.
+    if (kind_ == op_execute || num_ != 0)
+    {
+        statement_backend & backend = *st_.backEnd_;
+        bool const native = kind_ == op_execute ? backend.send_execute(num_)
+                                                : backend.send_fetch(num_);
+        if (!native)
+            worker_ = new worker(backend, kind_, num_);
+    }
+
+    st_.inc_ref();
+
+    // Any previous operation must not update gotData any longer.
+    if (gotData_)
+        st_.forget_got_data(gotData_);
+
+    st_.asyncOperations_.push_back(this);
+}
+
+async_operation::~async_operation()
+{
+    // The backend result must still be retrieved to leave the session in a
+    // usable state, but there is nobody to report the errors to any more.
+    if (!done_)
+    {
+        try
+        {
+            wait();
+        }
+        catch (...)
+        {
+        }
+    }
+
+    delete worker_;
+
+    std::vector<async_operation *> & ops = st_.asyncOperations_;
+    ops.erase(std::find(ops.begin(), ops.end(), this));
+
+    st_.dec_ref();
+}
+
+statement_backend::exec_fetch_result async_operation::wait()
+{
+    done_ = true;
+
+    if (worker_)
+        return worker_->wait();
+
+    if (kind_ == op_execute)
+        return st_.backEnd_->execute(num_);
+
+    if (num_ == 0)
+        return statement_backend::ef_no_data;
+
+    return st_.backEnd_->fetch(num_);
+}
+
+bool async_operation::is_ready()
+{
+    if (done_ || (kind_ == op_fetch && num_ == 0))
+        return true;
+
+    if (worker_)
+        return worker_->is_finished();
+
+    return st_.backEnd_->is_result_ready();
+}
+
+bool async_operation::get()
+{
+    if (done_)
+    {
+        throw soci_error("Result of asynchronous operation can only be "
+                         "retrieved once.");
+    }
+
+    try
+    {
+        statement_backend::exec_fetch_result const res = wait();
+
+        bool gotData;
+        if (kind_ == op_execute)
+        {
+            gotData = st_.finish_execute(num_, res, startTime_);
+        }
+        else if (num_ == 0)
+        {
+            st_.session_.set_got_data(false);
+            gotData = false;
+        }
+        else
+        {
+            gotData = st_.finish_fetch(res, startTime_);
+        }
+
+        if (gotData_)
+            *gotData_ = gotData;
+
+        return gotData;
+    }
+    catch (...)
+    {
+        st_.rethrow_current_exception_with_context(
+            kind_ == op_execute ? "executing" : "fetching data from");
+    }
+}
+
+async_result::async_result(details::async_operation * op)
+    : op_(op)
+{
+}
+
+async_result::async_result(async_result const & other)
+    : op_(other.op_)
+{
+    op_->add_ref();
+}
+
+async_result & async_result::operator=(async_result const & other)
+{
+    other.op_->add_ref();
+    if (op_->release())
+        delete op_;
+    op_ = other.op_;
+
+    return *this;
+}
+
+async_result::~async_result()
+{
+    if (op_->release())
+        delete op_;
+}
+
+bool async_result::is_ready()
+{
+    return op_->is_ready();
+}
+
+bool async_result::get()
+{
+    return op_->get();
+}
@@ -18,21 +18,18 @@
 #endif
 
 #include "soci_backends_config.h"
+#include "soci-mutex.h"
 
 using namespace soci;
+using namespace soci::details;
 using namespace soci::dynamic_backends;
 
 #ifdef _WIN32
 
 #include <windows.h>
 
-typedef CRITICAL_SECTION soci_mutex_t;
 typedef HMODULE soci_handler_t;
 
-#define LOCK(x) EnterCriticalSection(x)
-#define UNLOCK(x) LeaveCriticalSection(x)
-#define MUTEX_INIT(x) InitializeCriticalSection(x)
-#define MUTEX_DEST(x) DeleteCriticalSection(x)
 #ifdef _UNICODE
 #define DLOPEN(x) LoadLibraryA(x)
 #else
@@ -53,16 +50,10 @@ typedef HMODULE soci_handler_t;
 
 #else
 
-#include <pthread.h>
 #include <dlfcn.h>
 
-typedef pthread_mutex_t soci_mutex_t;
 typedef void * soci_handler_t;
 
-#define LOCK(x) pthread_mutex_lock(x)
-#define UNLOCK(x) pthread_mutex_unlock(x)
-#define MUTEX_INIT(x) pthread_mutex_init(x, NULL)
-#define MUTEX_DEST(x) pthread_mutex_destroy(x)
 #define DLOPEN(x) dlopen(x, RTLD_LAZY)
 #define DLCLOSE(x) dlclose(x)
 #define DLSYM(x, y) dlsym(x, y)
@@ -177,15 +168,6 @@ struct static_state_mgr
     }
 } static_state_mgr_;
 
-class scoped_lock
-{
-public:
-    scoped_lock(soci_mutex_t * m) : mptr(m) { LOCK(m); };
-    ~scoped_lock() { UNLOCK(mptr); };
-private:
-    soci_mutex_t * mptr;
-};
-
 // non-synchronized helpers for the other functions
 factory_map::iterator do_unload(factory_map::iterator i)
 {
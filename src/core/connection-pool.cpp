@@ -15,6 +15,9 @@
 #ifndef _WIN32
 // POSIX implementation
 
+#include "soci-timer.h"
+#include "soci-usdt.h"
+
 #include <pthread.h>
 #include <sys/time.h>
 #include <errno.h>
@@ -109,8 +112,18 @@ bool connection_pool::try_lease(std::size_t & pos, int timeout)
         throw soci_error("Synchronization error");
     }
 
+    bool const probed = SOCI_PROBE_ENABLED(pool_lease_acquire);
+    long long const startTime = probed ? details::monotonic_nanoseconds() : 0;
+
+    bool waiting = false;
     while (pimpl_->find_free(pos) == false)
     {
+        if (!waiting)
+        {
+            SOCI_PROBE2(pool_lease_wait, this, timeout);
+            waiting = true;
+        }
+
         if (timeout < 0)
         {
             // no timeout, allow unlimited blocking
@@ -146,6 +159,12 @@ bool connection_pool::try_lease(std::size_t & pos, int timeout)
 
     pthread_mutex_unlock(&(pimpl_->mtx_));
 
+    if (cc == 0 && probed)
+    {
+        SOCI_PROBE3(pool_lease_acquire, this, pos,
+            details::monotonic_nanoseconds() - startTime);
+    }
+
     if (cc != 0)
     {
         // we can only fail if timeout expired
@@ -183,6 +202,8 @@ void connection_pool::give_back(std::size_t pos)
 
     pthread_mutex_unlock(&(pimpl_->mtx_));
 
+    SOCI_PROBE2(pool_lease_release, this, pos);
+
     pthread_cond_signal(&(pimpl_->cond_));
 }
 
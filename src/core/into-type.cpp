@@ -8,10 +8,61 @@
 #define SOCI_SOURCE
 #include "soci/into-type.h"
 #include "soci/statement.h"
+#include "soci-exchange-cast.h"
 
 using namespace soci;
 using namespace soci::details;
 
+namespace // anonymous
+{
+
+// Return the size of a single value of the given type stored at data.
+std::size_t get_value_size(void * data, exchange_type type)
+{
+    switch (type)
+    {
+        case x_char:
+            return sizeof(exchange_type_traits<x_char>::value_type);
+        case x_stdstring:
+            return exchange_type_cast<x_stdstring>(data).size();
+        case x_short:
+            return sizeof(exchange_type_traits<x_short>::value_type);
+        case x_integer:
+            return sizeof(exchange_type_traits<x_integer>::value_type);
+        case x_long_long:
+            return sizeof(exchange_type_traits<x_long_long>::value_type);
+        case x_unsigned_long_long:
+            return sizeof(exchange_type_traits<x_unsigned_long_long>::value_type);
+        case x_double:
+            return sizeof(exchange_type_traits<x_double>::value_type);
+        case x_stdtm:
+            return sizeof(exchange_type_traits<x_stdtm>::value_type);
+        case x_longstring:
+            return exchange_type_cast<x_longstring>(data).value.size();
+        case x_xmltype:
+            return exchange_type_cast<x_xmltype>(data).value.size();
+        default:
+            // The size of the other types is unknown.
+            return 0;
+    }
+}
+
+template <typename T>
+std::size_t get_vector_data_size(void * data, exchange_type type)
+{
+    std::vector<T> & v = *static_cast<std::vector<T> *>(data);
+
+    std::size_t total = 0;
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        total += get_value_size(&v[i], type);
+    }
+
+    return total;
+}
+
+} // namespace anonymous
+
 standard_into_type::~standard_into_type()
 {
     delete backEnd_;
@@ -56,6 +107,11 @@ void standard_into_type::clean_up()
     }
 }
 
+std::size_t standard_into_type::data_size() const
+{
+    return get_value_size(data_, type_);
+}
+
 vector_into_type::~vector_into_type()
 {
     delete backEnd_;
@@ -120,6 +176,22 @@ std::size_t vector_into_type::size() const
     return backEnd_->size();
 }
 
+std::size_t vector_into_type::data_size() const
+{
+    switch (type_)
+    {
+        case x_stdstring:
+            return get_vector_data_size<exchange_type_traits<x_stdstring>::value_type>(data_, type_);
+        case x_longstring:
+            return get_vector_data_size<exchange_type_traits<x_longstring>::value_type>(data_, type_);
+        case x_xmltype:
+            return get_vector_data_size<exchange_type_traits<x_xmltype>::value_type>(data_, type_);
+        default:
+            // Fixed size types: no need to iterate over all the elements.
+            return size() * get_value_size(NULL, type_);
+    }
+}
+
 void vector_into_type::clean_up()
 {
     if (backEnd_ != NULL)
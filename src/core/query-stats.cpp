@@ -0,0 +1,456 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#define SOCI_SOURCE
+#include "soci/query-stats.h"
+#include "soci/error.h"
+#include "soci-mutex.h"
+// std
+#include <algorithm>
+#include <cctype>
+#include <iomanip>
+#include <map>
+
+using namespace soci;
+using namespace soci::details;
+
+namespace // anonymous
+{
+
+// Bounded random sample of durations used for percentile estimation.
+class duration_sample
+{
+public:
+    duration_sample() : seen_(0) {}
+
+    void add(long long value, std::size_t capacity, unsigned long & seed)
+    {
+        ++seen_;
+        if (samples_.size() < capacity)
+        {
+            samples_.push_back(value);
+            return;
+        }
+
+        // Reservoir sampling: keep the new value with probability equal to
+        // capacity/seen, replacing a random existing one.
+        seed = seed * 1103515245UL + 12345UL;
+        unsigned long long const pos = (seed >> 1) % seen_;
+        if (pos < capacity)
+        {
+            samples_[static_cast<std::size_t>(pos)] = value;
+        }
+    }
+
+    long long percentile(int p) const
+    {
+        if (samples_.empty())
+        {
+            return 0;
+        }
+
+        std::vector<long long> sorted(samples_);
+        std::vector<long long>::iterator const nth =
+            sorted.begin() + (sorted.size() - 1) * p / 100;
+        std::nth_element(sorted.begin(), nth, sorted.end());
+
+        return *nth;
+    }
+
+private:
+    std::vector<long long> samples_;
+    unsigned long long seen_;
+};
+
+struct stats_data
+{
+    query_stats_entry entry_;
+    duration_sample executeSample_;
+    duration_sample fetchSample_;
+};
+
+void update_min_max(long long value, unsigned long long count,
+    long long & minValue, long long & maxValue)
+{
+    if (count == 1 || value < minValue)
+    {
+        minValue = value;
+    }
+    if (count == 1 || value > maxValue)
+    {
+        maxValue = value;
+    }
+}
+
+bool is_identifier_char(char c)
+{
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '$';
+}
+
+char to_lower_char(char c)
+{
+    return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+}
+
+// Append the placeholder for a literal to the fingerprint, collapsing it with
+// the previous one if they're only separated by a comma.
+void append_literal(std::string & res, std::string::size_type & lastLiteralEnd)
+{
+    if (lastLiteralEnd != std::string::npos)
+    {
+        std::string const tail = res.substr(lastLiteralEnd);
+        if (tail == "," || tail == ", ")
+        {
+            res.resize(lastLiteralEnd);
+            return;
+        }
+    }
+
+    res += '?';
+    lastLiteralEnd = res.size();
+}
+
+double to_ms(long long ns)
+{
+    return static_cast<double>(ns) / 1000000.0;
+}
+
+void write_json_string(std::ostream & os, std::string const & s)
+{
+    os << '"';
+    for (std::string::const_iterator it = s.begin(); it != s.end(); ++it)
+    {
+        unsigned char const c = static_cast<unsigned char>(*it);
+        switch (c)
+        {
+            case '"':  os << "\\\""; break;
+            case '\\': os << "\\\\"; break;
+            case '\n': os << "\\n"; break;
+            case '\r': os << "\\r"; break;
+            case '\t': os << "\\t"; break;
+            default:
+                if (c < 0x20)
+                {
+                    os << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                       << static_cast<int>(c) << std::dec << std::setfill(' ');
+                }
+                else
+                {
+                    os << *it;
+                }
+        }
+    }
+    os << '"';
+}
+
+bool by_total_execute_time(query_stats_entry const & lhs,
+    query_stats_entry const & rhs)
+{
+    return lhs.total_execute_ns > rhs.total_execute_ns;
+}
+
+} // namespace anonymous
+
+struct query_stats::query_stats_impl
+{
+    explicit query_stats_impl(std::size_t sampleSize)
+        : sampleSize_(sampleSize), seed_(1)
+    {
+        MUTEX_INIT(&mutex_);
+    }
+
+    ~query_stats_impl()
+    {
+        MUTEX_DEST(&mutex_);
+    }
+
+    typedef std::map<std::string, stats_data> stats_map;
+
+    stats_map stats_;
+    std::size_t const sampleSize_;
+    unsigned long seed_;
+    mutable soci_mutex_t mutex_;
+};
+
+query_stats::query_stats(std::size_t sampleSize)
+    : pimpl_(new query_stats_impl(sampleSize))
+{
+}
+
+query_stats::~query_stats()
+{
+    delete pimpl_;
+}
+
+void query_stats::record_prepare(std::string const & fingerprint)
+{
+    scoped_lock lock(&pimpl_->mutex_);
+
+    ++pimpl_->stats_[fingerprint].entry_.prepares;
+}
+
+void query_stats::record_execute(std::string const & fingerprint,
+    long long durationNs, std::size_t rows, std::size_t bytes)
+{
+    scoped_lock lock(&pimpl_->mutex_);
+
+    stats_data & data = pimpl_->stats_[fingerprint];
+    query_stats_entry & e = data.entry_;
+
+    ++e.calls;
+    e.total_execute_ns += durationNs;
+    update_min_max(durationNs, e.calls, e.min_execute_ns, e.max_execute_ns);
+    e.rows_fetched += rows;
+    e.bytes_fetched += bytes;
+
+    data.executeSample_.add(durationNs, pimpl_->sampleSize_, pimpl_->seed_);
+}
+
+void query_stats::record_fetch(std::string const & fingerprint,
+    long long durationNs, std::size_t rows, std::size_t bytes)
+{
+    scoped_lock lock(&pimpl_->mutex_);
+
+    stats_data & data = pimpl_->stats_[fingerprint];
+    query_stats_entry & e = data.entry_;
+
+    ++e.fetches;
+    e.total_fetch_ns += durationNs;
+    update_min_max(durationNs, e.fetches, e.min_fetch_ns, e.max_fetch_ns);
+    e.rows_fetched += rows;
+    e.bytes_fetched += bytes;
+
+    data.fetchSample_.add(durationNs, pimpl_->sampleSize_, pimpl_->seed_);
+}
+
+std::vector<query_stats_entry> query_stats::snapshot() const
+{
+    std::vector<query_stats_entry> res;
+
+    {
+        scoped_lock lock(&pimpl_->mutex_);
+
+        res.reserve(pimpl_->stats_.size());
+        for (query_stats_impl::stats_map::const_iterator
+                it = pimpl_->stats_.begin(); it != pimpl_->stats_.end(); ++it)
+        {
+            stats_data const & data = it->second;
+
+            res.push_back(data.entry_);
+
+            query_stats_entry & e = res.back();
+            e.fingerprint = it->first;
+            e.p50_execute_ns = data.executeSample_.percentile(50);
+            e.p99_execute_ns = data.executeSample_.percentile(99);
+            e.p50_fetch_ns = data.fetchSample_.percentile(50);
+            e.p99_fetch_ns = data.fetchSample_.percentile(99);
+        }
+    }
+
+    std::stable_sort(res.begin(), res.end(), by_total_execute_time);
+
+    return res;
+}
+
+void query_stats::reset()
+{
+    scoped_lock lock(&pimpl_->mutex_);
+
+    pimpl_->stats_.clear();
+}
+
+void query_stats::dump_text(std::ostream & os) const
+{
+    std::vector<query_stats_entry> const entries = snapshot();
+
+    std::ios_base::fmtflags const flags = os.flags();
+    std::streamsize const precision = os.precision();
+
+    os << std::fixed << std::setprecision(3);
+
+    for (std::vector<query_stats_entry>::const_iterator it = entries.begin();
+        it != entries.end(); ++it)
+    {
+        query_stats_entry const & e = *it;
+
+        os << e.fingerprint << '\n'
+           << "  calls=" << e.calls
+           << " prepares=" << e.prepares
+           << " fetches=" << e.fetches
+           << " rows=" << e.rows_fetched
+           << " bytes=" << e.bytes_fetched << '\n'
+           << "  execute ms: total=" << to_ms(e.total_execute_ns)
+           << " min=" << to_ms(e.min_execute_ns)
+           << " max=" << to_ms(e.max_execute_ns)
+           << " p50=" << to_ms(e.p50_execute_ns)
+           << " p99=" << to_ms(e.p99_execute_ns) << '\n'
+           << "  fetch ms: total=" << to_ms(e.total_fetch_ns)
+           << " min=" << to_ms(e.min_fetch_ns)
+           << " max=" << to_ms(e.max_fetch_ns)
+           << " p50=" << to_ms(e.p50_fetch_ns)
+           << " p99=" << to_ms(e.p99_fetch_ns) << '\n';
+    }
+
+    os.flags(flags);
+    os.precision(precision);
+}
+
+void query_stats::dump_json(std::ostream & os) const
+{
+    std::vector<query_stats_entry> const entries = snapshot();
+
+    os << '[';
+    for (std::vector<query_stats_entry>::const_iterator it = entries.begin();
+        it != entries.end(); ++it)
+    {
+        query_stats_entry const & e = *it;
+
+        if (it != entries.begin())
+        {
+            os << ',';
+        }
+
+        os << "{\"fingerprint\":";
+        write_json_string(os, e.fingerprint);
+        os << ",\"prepares\":" << e.prepares
+           << ",\"calls\":" << e.calls
+           << ",\"fetches\":" << e.fetches
+           << ",\"rows_fetched\":" << e.rows_fetched
+           << ",\"bytes_fetched\":" << e.bytes_fetched
+           << ",\"total_execute_ns\":" << e.total_execute_ns
+           << ",\"min_execute_ns\":" << e.min_execute_ns
+           << ",\"max_execute_ns\":" << e.max_execute_ns
+           << ",\"p50_execute_ns\":" << e.p50_execute_ns
+           << ",\"p99_execute_ns\":" << e.p99_execute_ns
+           << ",\"total_fetch_ns\":" << e.total_fetch_ns
+           << ",\"min_fetch_ns\":" << e.min_fetch_ns
+           << ",\"max_fetch_ns\":" << e.max_fetch_ns
+           << ",\"p50_fetch_ns\":" << e.p50_fetch_ns
+           << ",\"p99_fetch_ns\":" << e.p99_fetch_ns
+           << '}';
+    }
+    os << ']';
+}
+
+std::string query_stats::fingerprint(std::string const & query)
+{
+    std::string res;
+    res.reserve(query.size());
+
+    std::string::size_type lastLiteralEnd = std::string::npos;
+    bool pendingSpace = false;
+
+    std::string::size_type const n = query.size();
+    std::string::size_type i = 0;
+    while (i < n)
+    {
+        char const c = query[i];
+        char const next = i + 1 < n ? query[i + 1] : '\0';
+
+        if (std::isspace(static_cast<unsigned char>(c)))
+        {
+            pendingSpace = true;
+            ++i;
+            continue;
+        }
+
+        if (c == '-' && next == '-')
+        {
+            i = query.find('\n', i);
+            if (i == std::string::npos)
+            {
+                i = n;
+            }
+
+            pendingSpace = true;
+            continue;
+        }
+
+        if (c == '/' && next == '*')
+        {
+            i = query.find("*/", i + 2);
+            i = i == std::string::npos ? n : i + 2;
+
+            pendingSpace = true;
+            continue;
+        }
+
+        if (pendingSpace && !res.empty())
+        {
+            res += ' ';
+        }
+        pendingSpace = false;
+
+        if (c == '\'')
+        {
+            // Skip the string literal, taking into account doubled quotes.
+            for (++i; i < n; ++i)
+            {
+                if (query[i] == '\'')
+                {
+                    if (i + 1 < n && query[i + 1] == '\'')
+                    {
+                        ++i;
+                        continue;
+                    }
+
+                    ++i;
+                    break;
+                }
+            }
+
+            append_literal(res, lastLiteralEnd);
+        }
+        else if (c == '"' || c == '`')
+        {
+            // Quoted identifiers are preserved as is.
+            std::string::size_type end = query.find(c, i + 1);
+            end = end == std::string::npos ? n : end + 1;
+
+            res.append(query, i, end - i);
+            i = end;
+        }
+        else if (std::isdigit(static_cast<unsigned char>(c)) ||
+                    (c == '.' && std::isdigit(static_cast<unsigned char>(next))))
+        {
+            // Numbers, including hexadecimal ones and those with exponents.
+            for (++i; i < n; ++i)
+            {
+                char const d = query[i];
+                if ((d == '+' || d == '-') &&
+                        (query[i - 1] == 'e' || query[i - 1] == 'E'))
+                {
+                    continue;
+                }
+
+                if (!std::isalnum(static_cast<unsigned char>(d)) && d != '.')
+                {
+                    break;
+                }
+            }
+
+            append_literal(res, lastLiteralEnd);
+        }
+        else if (is_identifier_char(c) || c == ':' || c == '?' || c == '@')
+        {
+            // Identifiers, keywords and parameter placeholders, possibly
+            // containing digits which must not be taken for literals.
+            res += to_lower_char(c);
+            for (++i; i < n && is_identifier_char(query[i]); ++i)
+            {
+                res += to_lower_char(query[i]);
+            }
+        }
+        else
+        {
+            res += c;
+            ++i;
+        }
+    }
+
+    return res;
+}
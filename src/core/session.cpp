@@ -11,6 +11,8 @@
 #include "soci/connection-pool.h"
 #include "soci/soci-backend.h"
 #include "soci/query_transformation.h"
+#include "soci-timer.h"
+#include "soci-usdt.h"
 
 using namespace soci;
 using namespace soci::details;
@@ -74,7 +76,7 @@ private:
 
 session::session()
     : once(this), prepare(this), query_transformation_(NULL),
-      logger_(new standard_logger_impl),
+      logger_(new standard_logger_impl), queryStats_(NULL),
       uppercaseColumnNames_(false), backEnd_(NULL),
       isFromPool_(false), pool_(NULL)
 {
@@ -82,7 +84,7 @@ session::session()
 
 session::session(connection_parameters const & parameters)
     : once(this), prepare(this), query_transformation_(NULL),
-      logger_(new standard_logger_impl),
+      logger_(new standard_logger_impl), queryStats_(NULL),
       lastConnectParameters_(parameters),
       uppercaseColumnNames_(false), backEnd_(NULL),
       isFromPool_(false), pool_(NULL)
@@ -93,7 +95,7 @@ session::session(connection_parameters const & parameters)
 session::session(backend_factory const & factory,
     std::string const & connectString)
     : once(this), prepare(this), query_transformation_(NULL),
-    logger_(new standard_logger_impl),
+    logger_(new standard_logger_impl), queryStats_(NULL),
       lastConnectParameters_(factory, connectString),
       uppercaseColumnNames_(false), backEnd_(NULL),
       isFromPool_(false), pool_(NULL)
@@ -104,7 +106,7 @@ session::session(backend_factory const & factory,
 session::session(std::string const & backendName,
     std::string const & connectString)
     : once(this), prepare(this), query_transformation_(NULL),
-      logger_(new standard_logger_impl),
+      logger_(new standard_logger_impl), queryStats_(NULL),
       lastConnectParameters_(backendName, connectString),
       uppercaseColumnNames_(false), backEnd_(NULL),
       isFromPool_(false), pool_(NULL)
@@ -114,7 +116,7 @@ session::session(std::string const & backendName,
 
 session::session(std::string const & connectString)
     : once(this), prepare(this), query_transformation_(NULL),
-      logger_(new standard_logger_impl),
+      logger_(new standard_logger_impl), queryStats_(NULL),
       lastConnectParameters_(connectString),
       uppercaseColumnNames_(false), backEnd_(NULL),
       isFromPool_(false), pool_(NULL)
@@ -124,7 +126,7 @@ session::session(std::string const & connectString)
 
 session::session(connection_pool & pool)
     : query_transformation_(NULL),
-      logger_(new standard_logger_impl),
+      logger_(new standard_logger_impl), queryStats_(NULL),
       isFromPool_(true), pool_(&pool)
 {
     poolPosition_ = pool.lease();
@@ -251,10 +253,26 @@ bool session::is_connected() const SOCI_NOEXCEPT
     }
 }
 
+void session::cancel()
+{
+    ensureConnected(backEnd_);
+
+    backEnd_->cancel();
+}
+
+int session::native_socket()
+{
+    ensureConnected(backEnd_);
+
+    return backEnd_->get_native_socket();
+}
+
 void session::begin()
 {
     ensureConnected(backEnd_);
 
+    SOCI_PROBE1(transaction_begin, this);
+
     backEnd_->begin();
 }
 
@@ -262,14 +280,30 @@ void session::commit()
 {
     ensureConnected(backEnd_);
 
+    bool const probed = SOCI_PROBE_ENABLED(transaction_commit);
+    long long const startTime = probed ? monotonic_nanoseconds() : 0;
+
     backEnd_->commit();
+
+    if (probed)
+    {
+        SOCI_PROBE2(transaction_commit, this, monotonic_nanoseconds() - startTime);
+    }
 }
 
 void session::rollback()
 {
     ensureConnected(backEnd_);
 
+    bool const probed = SOCI_PROBE_ENABLED(transaction_rollback);
+    long long const startTime = probed ? monotonic_nanoseconds() : 0;
+
     backEnd_->rollback();
+
+    if (probed)
+    {
+        SOCI_PROBE2(transaction_rollback, this, monotonic_nanoseconds() - startTime);
+    }
 }
 
 std::ostringstream & session::get_query_stream()
@@ -391,6 +425,30 @@ std::string session::get_last_query() const
     }
 }
 
+void session::set_query_stats(query_stats * stats)
+{
+    if (isFromPool_)
+    {
+        pool_->at(poolPosition_).set_query_stats(stats);
+    }
+    else
+    {
+        queryStats_ = stats;
+    }
+}
+
+query_stats * session::get_query_stats() const
+{
+    if (isFromPool_)
+    {
+        return pool_->at(poolPosition_).get_query_stats();
+    }
+    else
+    {
+        return queryStats_;
+    }
+}
+
 void session::set_got_data(bool gotData)
 {
     if (isFromPool_)
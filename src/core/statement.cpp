@@ -11,7 +11,11 @@
 #include "soci/into-type.h"
 #include "soci/use-type.h"
 #include "soci/values.h"
+#include "soci/query-stats.h"
+#include "soci-async-operation.h"
 #include "soci-compiler.h"
+#include "soci-timer.h"
+#include "soci-usdt.h"
 #include <ctime>
 #include <cctype>
 
@@ -195,9 +199,24 @@ void statement_impl::prepare(std::string const & query,
     try
     {
         query_ = query;
+        fingerprint_.clear();
         session_.log_query(query);
 
+        bool const probed = SOCI_PROBE_ENABLED(prepare);
+        long long const startTime = probed ? monotonic_nanoseconds() : 0;
+
         backEnd_->prepare(query, eType);
+
+        if (probed)
+        {
+            SOCI_PROBE3(prepare, this, query_.c_str(),
+                monotonic_nanoseconds() - startTime);
+        }
+
+        if (query_stats * const stats = session_.get_query_stats())
+        {
+            stats->record_prepare(get_fingerprint());
+        }
     }
     catch (...)
     {
@@ -262,100 +281,154 @@ bool statement_impl::execute(bool withDataExchange)
 {
     try
     {
-        initialFetchSize_ = intos_size();
+        query_stats * const stats = session_.get_query_stats();
+        bool const probed = SOCI_PROBE_ENABLED(execute_end);
+        long long const startTime
+            = stats || probed ? monotonic_nanoseconds() : 0;
 
-        if (intos_.empty() == false && initialFetchSize_ == 0)
-        {
-            // this can happen only with into-vectors elements
-            // and is not allowed when calling execute
-            throw soci_error("Vectors of size 0 are not allowed.");
-        }
+        int const num = start_execute(withDataExchange);
 
-        fetchSize_ = initialFetchSize_;
+        statement_backend::exec_fetch_result res = backEnd_->execute(num);
 
-        // pre-use should be executed before inspecting the sizes of use
-        // elements, as they can be resized in type conversion routines
+        return finish_execute(num, res, startTime);
+    }
+    catch (...)
+    {
+        rethrow_current_exception_with_context("executing");
+    }
+}
 
-        pre_use();
+async_result statement_impl::execute_async(bool withDataExchange,
+                                           bool * gotData)
+{
+    try
+    {
+        long long const startTime = monotonic_nanoseconds();
 
-        std::size_t const bindSize = uses_size();
+        int const num = start_execute(withDataExchange);
 
-        if (bindSize > 1 && fetchSize_ > 1)
-        {
-            throw soci_error(
-                 "Bulk insert/update and bulk select not allowed in same query");
-        }
+        return async_result(new async_operation(*this,
+            async_operation::op_execute, num, startTime, gotData));
+    }
+    catch (...)
+    {
+        rethrow_current_exception_with_context("executing");
+    }
+}
 
-        // looks like a hack and it is - row description should happen
-        // *after* the use elements were completely prepared
-        // and *before* the into elements are touched, so that the row
-        // description process can inject more into elements for
-        // implicit data exchange
-        if (row_ != NULL && alreadyDescribed_ == false)
-        {
-            describe();
-            define_for_row();
-        }
+int statement_impl::start_execute(bool withDataExchange)
+{
+    SOCI_PROBE2(execute_begin, this, query_.c_str());
 
-        int num = 0;
-        if (withDataExchange)
-        {
-            num = 1;
+    initialFetchSize_ = intos_size();
 
-            pre_fetch();
+    if (intos_.empty() == false && initialFetchSize_ == 0)
+    {
+        // this can happen only with into-vectors elements
+        // and is not allowed when calling execute
+        throw soci_error("Vectors of size 0 are not allowed.");
+    }
 
-            if (static_cast<int>(fetchSize_) > num)
-            {
-                num = static_cast<int>(fetchSize_);
-            }
-            if (static_cast<int>(bindSize) > num)
-            {
-                num = static_cast<int>(bindSize);
-            }
-        }
+    fetchSize_ = initialFetchSize_;
 
-        pre_exec(num);
+    // pre-use should be executed before inspecting the sizes of use
+    // elements, as they can be resized in type conversion routines
 
-        statement_backend::exec_fetch_result res = backEnd_->execute(num);
+    pre_use();
 
-        bool gotData = false;
+    std::size_t const bindSize = uses_size();
 
-        if (res == statement_backend::ef_success)
-        {
-            // the "success" means that the statement executed correctly
-            // and for select statement this also means that some rows were read
+    if (bindSize > 1 && fetchSize_ > 1)
+    {
+        throw soci_error(
+             "Bulk insert/update and bulk select not allowed in same query");
+    }
 
-            if (num > 0)
-            {
-                gotData = true;
+    // looks like a hack and it is - row description should happen
+    // *after* the use elements were completely prepared
+    // and *before* the into elements are touched, so that the row
+    // description process can inject more into elements for
+    // implicit data exchange
+    if (row_ != NULL && alreadyDescribed_ == false)
+    {
+        describe();
+        define_for_row();
+    }
 
-                // ensure into vectors have correct size
-                resize_intos(static_cast<std::size_t>(num));
-            }
+    int num = 0;
+    if (withDataExchange)
+    {
+        num = 1;
+
+        pre_fetch();
+
+        if (static_cast<int>(fetchSize_) > num)
+        {
+            num = static_cast<int>(fetchSize_);
         }
-        else // res == ef_no_data
+        if (static_cast<int>(bindSize) > num)
         {
-            // the "no data" means that the end-of-rowset condition was hit
-            // but still some rows might have been read (the last bunch of rows)
-            // it can also mean that the statement did not produce any results
-
-            gotData = fetchSize_ > 1 ? resize_intos() : false;
+            num = static_cast<int>(bindSize);
         }
+    }
+
+    pre_exec(num);
+
+    return num;
+}
+
+bool statement_impl::finish_execute(int num,
+    statement_backend::exec_fetch_result res, long long startTime)
+{
+    bool gotData = false;
+
+    if (res == statement_backend::ef_success)
+    {
+        // the "success" means that the statement executed correctly
+        // and for select statement this also means that some rows were read
 
         if (num > 0)
         {
-            post_fetch(gotData, false);
+            gotData = true;
+
+            // ensure into vectors have correct size
+            resize_intos(static_cast<std::size_t>(num));
         }
+    }
+    else // res == ef_no_data
+    {
+        // the "no data" means that the end-of-rowset condition was hit
+        // but still some rows might have been read (the last bunch of rows)
+        // it can also mean that the statement did not produce any results
 
-        post_use(gotData);
+        gotData = fetchSize_ > 1 ? resize_intos() : false;
+    }
 
-        session_.set_got_data(gotData);
-        return gotData;
+    if (num > 0)
+    {
+        post_fetch(gotData, false);
     }
-    catch (...)
+
+    post_use(gotData);
+
+    query_stats * const stats = session_.get_query_stats();
+    if (stats || SOCI_PROBE_ENABLED(execute_end))
     {
-        rethrow_current_exception_with_context("executing");
+        bool const fetched = gotData && num > 0;
+        std::size_t const rows = fetched ? intos_size() : 0;
+        long long const duration = monotonic_nanoseconds() - startTime;
+
+        if (stats)
+        {
+            stats->record_execute(get_fingerprint(), duration, rows,
+                fetched ? fetched_data_size() : 0);
+        }
+
+        SOCI_PROBE4(execute_end, this, query_.c_str(), rows, duration);
     }
+
+    session_.set_got_data(gotData);
+    return gotData;
 }
 
 long long statement_impl::get_affected_rows()
@@ -370,76 +443,158 @@ long long statement_impl::get_affected_rows()
     }
 }
 
+void statement_impl::set_timeout(int milliseconds)
+{
+    if (milliseconds < 0)
+    {
+        throw soci_error("Statement timeout can't be negative.");
+    }
+
+    try
+    {
+        backEnd_->set_timeout(milliseconds);
+    }
+    catch (...)
+    {
+        rethrow_current_exception_with_context("setting timeout of");
+    }
+}
+
 bool statement_impl::fetch()
 {
     try
     {
-        if (fetchSize_ == 0)
+        query_stats * const stats = session_.get_query_stats();
+        bool const probed = SOCI_PROBE_ENABLED(fetch);
+        long long const startTime
+            = stats || probed ? monotonic_nanoseconds() : 0;
+
+        std::size_t const num = start_fetch();
+        if (num == 0)
         {
-            truncate_intos();
             session_.set_got_data(false);
             return false;
         }
 
-        bool gotData = false;
+        statement_backend::exec_fetch_result const res
+            = backEnd_->fetch(static_cast<int>(num));
 
-        // vectors might have been resized between fetches
-        std::size_t const newFetchSize = intos_size();
-        if (newFetchSize > initialFetchSize_)
-        {
-            // this is not allowed, because most likely caused reallocation
-            // of the vector - this would require complete re-bind
+        return finish_fetch(res, startTime);
+    }
+    catch (...)
+    {
+        rethrow_current_exception_with_context("fetching data from");
+    }
+}
 
-            throw soci_error(
-                "Increasing the size of the output vector is not supported.");
-        }
-        else if (newFetchSize == 0)
+async_result statement_impl::fetch_async(bool * gotData)
+{
+    try
+    {
+        long long const startTime = monotonic_nanoseconds();
+
+        std::size_t const num = start_fetch();
+
+        return async_result(new async_operation(*this,
+            async_operation::op_fetch, static_cast<int>(num), startTime,
+            gotData));
+    }
+    catch (...)
+    {
+        rethrow_current_exception_with_context("fetching data from");
+    }
+}
+
+void statement_impl::forget_got_data(bool * gotData)
+{
+    for (std::size_t i = 0; i != asyncOperations_.size(); ++i)
+    {
+        asyncOperations_[i]->forget_got_data(gotData);
+    }
+}
+
+std::size_t statement_impl::start_fetch()
+{
+    if (fetchSize_ == 0)
+    {
+        truncate_intos();
+        return 0;
+    }
+
+    // vectors might have been resized between fetches
+    std::size_t const newFetchSize = intos_size();
+    if (newFetchSize > initialFetchSize_)
+    {
+        // this is not allowed, because most likely caused reallocation
+        // of the vector - this would require complete re-bind
+
+        throw soci_error(
+            "Increasing the size of the output vector is not supported.");
+    }
+    else if (newFetchSize == 0)
+    {
+        return 0;
+    }
+    else
+    {
+        // the output vector was downsized or remains the same as before
+        fetchSize_ = newFetchSize;
+    }
+
+    return fetchSize_;
+}
+
+bool statement_impl::finish_fetch(statement_backend::exec_fetch_result res,
+    long long startTime)
+{
+    bool gotData = false;
+
+    if (res == statement_backend::ef_success)
+    {
+        // the "success" means that some number of rows was read
+        // and that it is not yet the end-of-rowset (there are more rows)
+
+        gotData = true;
+
+        // ensure into vectors have correct size
+        resize_intos(fetchSize_);
+    }
+    else // res == ef_no_data
+    {
+        // end-of-rowset condition
+
+        if (fetchSize_ > 1)
         {
-            session_.set_got_data(false);
-            return false;
+            // but still the last bunch of rows might have been read
+            gotData = resize_intos();
+            fetchSize_ = 0;
         }
         else
         {
-            // the output vector was downsized or remains the same as before
-            fetchSize_ = newFetchSize;
+            truncate_intos();
+            gotData = false;
         }
+    }
 
-        statement_backend::exec_fetch_result const res = backEnd_->fetch(static_cast<int>(fetchSize_));
-        if (res == statement_backend::ef_success)
-        {
-            // the "success" means that some number of rows was read
-            // and that it is not yet the end-of-rowset (there are more rows)
+    post_fetch(gotData, true);
 
-            gotData = true;
+    query_stats * const stats = session_.get_query_stats();
+    if (stats || SOCI_PROBE_ENABLED(fetch))
+    {
+        std::size_t const rows = gotData ? intos_size() : 0;
+        long long const duration = monotonic_nanoseconds() - startTime;
 
-            // ensure into vectors have correct size
-            resize_intos(fetchSize_);
-        }
-        else // res == ef_no_data
+        if (stats)
         {
-            // end-of-rowset condition
-
-            if (fetchSize_ > 1)
-            {
-                // but still the last bunch of rows might have been read
-                gotData = resize_intos();
-                fetchSize_ = 0;
-            }
-            else
-            {
-                truncate_intos();
-                gotData = false;
-            }
+            stats->record_fetch(get_fingerprint(), duration, rows,
+                gotData ? fetched_data_size() : 0);
         }
 
-        post_fetch(gotData, true);
-        session_.set_got_data(gotData);
-        return gotData;
-    }
-    catch (...)
-    {
-        rethrow_current_exception_with_context("fetching data from");
+        SOCI_PROBE4(fetch, this, query_.c_str(), rows, duration);
     }
+
+    session_.set_got_data(gotData);
+    return gotData;
 }
 
 std::size_t statement_impl::intos_size()
@@ -532,6 +687,35 @@ void statement_impl::truncate_intos()
     }
 }
 
+std::string const & statement_impl::get_fingerprint()
+{
+    if (fingerprint_.empty())
+    {
+        fingerprint_ = query_stats::fingerprint(query_);
+    }
+
+    return fingerprint_;
+}
+
+std::size_t statement_impl::fetched_data_size()
+{
+    std::size_t total = 0;
+
+    std::size_t const isize = intos_.size();
+    for (std::size_t i = 0; i != isize; ++i)
+    {
+        total += intos_[i]->data_size();
+    }
+
+    std::size_t const ifrsize = intosForRow_.size();
+    for (std::size_t i = 0; i != ifrsize; ++i)
+    {
+        total += intosForRow_[i]->data_size();
+    }
+
+    return total;
+}
+
 void statement_impl::pre_exec(int num)
 {
     std::size_t const isize = intos_.size();
@@ -0,0 +1,25 @@
+//
+// Copyright (C) 2026 SOCI contributors
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#define SOCI_SOURCE
+#include "soci-usdt.h"
+
+#ifdef SOCI_HAVE_USDT
+
+// Semaphores of all the probes declared in soci-usdt.h.
+SOCI_DEFINE_PROBE(prepare)
+SOCI_DEFINE_PROBE(execute_begin)
+SOCI_DEFINE_PROBE(execute_end)
+SOCI_DEFINE_PROBE(fetch)
+SOCI_DEFINE_PROBE(pool_lease_wait)
+SOCI_DEFINE_PROBE(pool_lease_acquire)
+SOCI_DEFINE_PROBE(pool_lease_release)
+SOCI_DEFINE_PROBE(transaction_begin)
+SOCI_DEFINE_PROBE(transaction_commit)
+SOCI_DEFINE_PROBE(transaction_rollback)
+
+#endif // SOCI_HAVE_USDT
@@ -5227,6 +5227,118 @@ TEST_CASE_METHOD(common_tests, "Logger", "[core][log]")
     sql.set_logger(logger_orig);
 }
 
+TEST_CASE_METHOD(common_tests, "Asynchronous logger", "[core][log][async]")
+{
+    soci::session sql(backEndFactory_, connectString_);
+    auto_table_creator tableCreator(tc_.table_creator_1(sql));
+
+    soci::logger const logger_orig = sql.get_logger();
+
+    // Use a small maximal query length to check that truncation works.
+    async_logger_impl * const impl = new async_logger_impl(16, 32);
+    soci::logger const log(impl);
+    sql.set_logger(log);
+
+    std::ostringstream oss;
+    sql.set_log_stream(&oss);
+    CHECK( sql.get_log_stream() == &oss );
+
+    int count;
+    sql << "select count(*) from soci_test", into(count);
+    CHECK( sql.get_last_query() == "select count(*) from soci_test" );
+
+    sql.set_log_stream(NULL);
+    sql << "select id from soci_test";
+    CHECK( sql.get_last_query() == "select id from soci_test" );
+
+    sql.set_log_stream(&oss);
+    sql << "select count(*) from soci_test where id = 1234567890", into(count);
+
+    impl->flush();
+
+    CHECK( oss.str() ==
+        "select count(*) from soci_test\n"
+        "select count(*) from soci_test w\n" );
+    CHECK( impl->get_logged_count() == 2 );
+    CHECK( impl->get_truncated_count() == 1 );
+    CHECK( impl->get_dropped_count() == 0 );
+
+    sql.set_logger(logger_orig);
+}
+
+TEST_CASE_METHOD(common_tests, "Query statistics", "[core][stats]")
+{
+    SECTION("Fingerprint")
+    {
+        CHECK( query_stats::fingerprint(
+                    "SELECT  name\n  FROM t WHERE id = 17 -- comment")
+                == "select name from t where id = ?" );
+        CHECK( query_stats::fingerprint(
+                    "insert into t(a, b) values ('x''y', 1.5e3)")
+                == "insert into t(a, b) values (?)" );
+        CHECK( query_stats::fingerprint(
+                    "select * from t where id in (1, 2, 3) and n = :name")
+                == "select * from t where id in (?) and n = :name" );
+        CHECK( query_stats::fingerprint("select /* x */ \"Col\" from t")
+                == "select \"Col\" from t" );
+    }
+
+    soci::session sql(backEndFactory_, connectString_);
+    auto_table_creator tableCreator(tc_.table_creator_1(sql));
+
+    query_stats stats;
+    sql.set_query_stats(&stats);
+    CHECK( sql.get_query_stats() == &stats );
+
+    for (int i = 0; i != 3; ++i)
+    {
+        sql << "insert into soci_test(id) values(" << i << ")";
+    }
+
+    std::vector<int> ids(10);
+    sql << "select id from soci_test", into(ids);
+    CHECK( ids.size() == 3 );
+
+    sql.set_query_stats(NULL);
+
+    // This one must not be accounted for any more.
+    int count;
+    sql << "select count(*) from soci_test", into(count);
+
+    std::vector<query_stats_entry> const entries = stats.snapshot();
+    REQUIRE( entries.size() == 2 );
+
+    for (std::size_t i = 0; i != entries.size(); ++i)
+    {
+        query_stats_entry const& e = entries[i];
+        if (e.fingerprint == "insert into soci_test(id) values(?)")
+        {
+            CHECK( e.prepares == 3 );
+            CHECK( e.calls == 3 );
+            CHECK( e.rows_fetched == 0 );
+        }
+        else
+        {
+            CHECK( e.fingerprint == "select id from soci_test" );
+            CHECK( e.prepares == 1 );
+            CHECK( e.calls == 1 );
+            CHECK( e.rows_fetched == 3 );
+            CHECK( e.bytes_fetched == 3*sizeof(int) );
+        }
+
+        CHECK( e.min_execute_ns <= e.p50_execute_ns );
+        CHECK( e.p50_execute_ns <= e.max_execute_ns );
+        CHECK( e.max_execute_ns <= e.total_execute_ns );
+    }
+
+    std::ostringstream oss;
+    stats.dump_json(oss);
+    CHECK( oss.str().find("\"select id from soci_test\"") != std::string::npos );
+
+    stats.reset();
+    CHECK( stats.snapshot().empty() );
+}
+
 // These tests are disabled by default, as they require manual intevention, but
 // can be run by explicitly giving their names on the command line.
 
@@ -141,6 +141,104 @@ TEST_CASE("Dummy test", "[empty]")
     }
 }
 
+TEST_CASE("Mock result set", "[empty][mock]")
+{
+    soci::session sql(backEnd, "rows=5 columns=integer,string,double");
+
+    // Into elements get the values of the synthetic result set.
+    {
+        int n = -1;
+        std::string s;
+        double d = 0;
+        statement st = (sql.prepare << "select", into(n), into(s), into(d));
+        st.execute();
+
+        int count = 0;
+        while (st.fetch())
+        {
+            CHECK(n == count);
+            CHECK(s == "xxxxxxxx");
+            CHECK(d == count + 0.5);
+            ++count;
+        }
+        CHECK(count == 5);
+    }
+
+    // Bulk fetch returns all the remaining rows.
+    {
+        std::vector<int> numbers(3);
+        statement st = (sql.prepare << "select", into(numbers));
+        REQUIRE(st.execute(true));
+        CHECK(numbers.size() == 3);
+        CHECK(numbers[2] == 2);
+
+        REQUIRE(st.fetch());
+        REQUIRE(numbers.size() == 2);
+        CHECK(numbers[0] == 3);
+        CHECK(numbers[1] == 4);
+
+        CHECK(!st.fetch());
+    }
+
+    // Dynamic rows can be used too.
+    {
+        rowset<row> rs = (sql.prepare << "select");
+        int count = 0;
+        for (rowset<row>::const_iterator it = rs.begin(); it != rs.end(); ++it)
+        {
+            row const& r = *it;
+            REQUIRE(r.size() == 3);
+            CHECK(r.get_properties(0).get_name() == "c1");
+            CHECK(r.get<int>(0) == count);
+            CHECK(r.get<std::string>(1) == "xxxxxxxx");
+            ++count;
+        }
+        CHECK(count == 5);
+    }
+
+    // Without into elements the statement is considered to affect all rows.
+    {
+        std::vector<int> numbers(10);
+        statement st = (sql.prepare << "insert", use(numbers));
+        st.execute(true);
+        CHECK(st.get_affected_rows() == 10);
+    }
+
+    // The result set can be changed on the fly.
+    {
+        empty_session_backend* const backend
+            = static_cast<empty_session_backend*>(sql.get_backend());
+
+        empty_result_set resultSet;
+        resultSet.rows = 0;
+        resultSet.columns.push_back(dt_long_long);
+        backend->set_result_set(resultSet);
+
+        long long ll = 17;
+        sql << "select", into(ll);
+        CHECK(!sql.got_data());
+        CHECK(ll == 17);
+
+        // Including while a statement is being fetched.
+        resultSet.rows = 5;
+        backend->set_result_set(resultSet);
+
+        std::vector<long long> lls(2);
+        statement st = (sql.prepare << "select", into(lls));
+        CHECK(st.execute(true));
+        CHECK(lls.size() == 2);
+
+        resultSet.rows = 1;
+        backend->set_result_set(resultSet);
+
+        CHECK(!st.fetch());
+        CHECK(lls.empty());
+    }
+
+    CHECK_THROWS_AS(soci::session(backEnd, "columns=blob"), soci_error&);
+    CHECK_THROWS_AS(soci::session(backEnd, "rows=many"), soci_error&);
+}
+
 
 int main(int argc, char** argv)
 {
@@ -13,7 +13,9 @@
 #include "firebird/common.h"
 #include "common-tests.h"
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <vector>
 #include <ctime>
 #include <cstring>
 #include <cmath>
@@ -1221,6 +1223,138 @@ TEST_CASE("Firebird decimals as strings", "[firebird][decimal][string]")
     sql << "drop table test13";
 }
 
+TEST_CASE("Firebird bulk operations", "[firebird][bulk]")
+{
+    soci::session sql(backEnd, connectString);
+
+    try
+    {
+        sql << "drop table test14";
+    }
+    catch (std::runtime_error &)
+    {} // ignore if error
+
+    sql << "create table test14(id integer, s varchar(20), "
+        << "n numeric(10,2), d double precision, tm timestamp)";
+    sql.commit();
+
+    sql.begin();
+
+    // Use enough rows to require more than one batch and values needing
+    // quoting or conversion to check that they are all passed correctly.
+    int const rows = 1000;
+
+    std::vector<int> ids(rows);
+    std::vector<std::string> ss(rows);
+    std::vector<indicator> inds(rows);
+    std::vector<double> ns(rows);
+    std::vector<double> ds(rows);
+    std::vector<std::tm> tms(rows);
+    for (int i = 0; i != rows; ++i)
+    {
+        ids[i] = i;
+
+        std::ostringstream oss;
+        oss << "it's \"" << i << "\"";
+        ss[i] = oss.str();
+        inds[i] = i % 7 ? i_ok : i_null;
+
+        ns[i] = i + 0.25;
+        ds[i] = i / 8.0;
+
+        std::tm t = std::tm();
+        t.tm_year = 120;
+        t.tm_mon = i % 12;
+        t.tm_mday = i % 28 + 1;
+        t.tm_hour = i % 24;
+        t.tm_min = i % 60;
+        t.tm_sec = 59 - i % 60;
+        tms[i] = t;
+    }
+
+    {
+        statement st = (sql.prepare <<
+            "insert into test14(id, s, n, d, tm) values(:id, :s, :n, :d, :tm)",
+            use(ids), use(ss, inds), use(ns), use(ds), use(tms));
+        st.execute(true);
+        CHECK(st.get_affected_rows() == rows);
+    }
+
+    int count = 0;
+    sql << "select count(*) from test14", into(count);
+    CHECK(count == rows);
+
+    std::vector<int> ids2(rows);
+    std::vector<std::string> ss2(rows);
+    std::vector<indicator> inds2(rows);
+    std::vector<double> ns2(rows);
+    std::vector<double> ds2(rows);
+    std::vector<std::tm> tms2(rows);
+    sql << "select id, s, n, d, tm from test14 order by id",
+        into(ids2), into(ss2, inds2), into(ns2), into(ds2), into(tms2);
+    REQUIRE(ids2.size() == static_cast<std::size_t>(rows));
+
+    for (int i = 0; i != rows; ++i)
+    {
+        CHECK(ids2[i] == i);
+        CHECK(inds2[i] == inds[i]);
+        if (inds[i] == i_ok)
+            CHECK(ss2[i] == ss[i]);
+        CHECK(ns2[i] == ns[i]);
+        CHECK(ds2[i] == ds[i]);
+        CHECK(tms2[i].tm_mon == tms[i].tm_mon);
+        CHECK(tms2[i].tm_mday == tms[i].tm_mday);
+        CHECK(tms2[i].tm_hour == tms[i].tm_hour);
+        CHECK(tms2[i].tm_sec == tms[i].tm_sec);
+    }
+
+    // Check that the affected rows are counted correctly for the statements
+    // affecting either none or several rows per execution too.
+    {
+        std::vector<int> los(3), his(3);
+        los[0] = 0;     his[0] = 100;
+        los[1] = rows;  his[1] = rows + 10;
+        los[2] = 500;   his[2] = 700;
+
+        statement st = (sql.prepare <<
+            "update test14 set d = 0 where id >= :lo and id < :hi",
+            use(los), use(his));
+        st.execute(true);
+        CHECK(st.get_affected_rows() == 300);
+
+        statement st2 = (sql.prepare <<
+            "delete from test14 where id = :id", use(ids));
+        st2.execute(true);
+        CHECK(st2.get_affected_rows() == rows);
+    }
+
+    sql.commit();
+
+    sql << "drop table test14";
+
+    // If one of the rows fails, none of the rows of the same batch is applied.
+    sql << "create table test14(id integer check (id < 2))";
+    sql.commit();
+
+    sql.begin();
+    {
+        std::vector<int> ids3;
+        ids3.push_back(0);
+        ids3.push_back(1);
+        ids3.push_back(2);
+
+        CHECK_THROWS_AS((sql << "insert into test14(id) values(:id)",
+                         use(ids3)), firebird_soci_error&);
+
+        int count3 = -1;
+        sql << "select count(*) from test14", into(count3);
+        CHECK(count3 == 0);
+    }
+    sql.commit();
+
+    sql << "drop table test14";
+}
+
 //
 // Support for soci Common Tests
 //
@@ -794,6 +794,380 @@ TEST_CASE("MySQL last insert id", "[mysql][last-insert-id]")
     CHECK(id == 42);
 }
 
+struct text_protocol_table_creator : table_creator_base
+{
+    text_protocol_table_creator(soci::session & sql)
+        : table_creator_base(sql)
+    {
+        sql << "create table soci_test(i integer, ll bigint, "
+            "ull bigint unsigned, d double, s varchar(20), b varbinary(20), "
+            "t datetime, n integer)";
+    }
+};
+
+TEST_CASE("MySQL one-time queries", "[mysql][text-protocol]")
+{
+    soci::session sql(backEnd, connectString);
+    text_protocol_table_creator tableCreator(sql);
+
+    sql << "insert into soci_test(i, ll, ull, d, s, b, t, n) values"
+        "(-17, 9223372036854775807, 18446744073709551615, 3.25, 'foo', "
+        "x'610062', '2024-02-29 12:34:56', NULL)";
+
+    // Queries without parameters are executed using the text protocol, check
+    // that all types are converted correctly.
+    int i = 0;
+    long long ll = 0;
+    unsigned long long ull = 0;
+    double d = 0;
+    std::string s, b;
+    std::tm t = std::tm();
+    int n = 0;
+    indicator ind = i_ok;
+    sql << "select i, ll, ull, d, s, b, t, n from soci_test",
+        into(i), into(ll), into(ull), into(d), into(s), into(b), into(t),
+        into(n, ind);
+    CHECK(i == -17);
+    CHECK(ll == 9223372036854775807LL);
+    CHECK(ull == 18446744073709551615ULL);
+    CHECK(d == 3.25);
+    CHECK(s == "foo");
+    CHECK(b == std::string("a\0b", 3));
+    CHECK(t.tm_year == 124);
+    CHECK(t.tm_mon == 1);
+    CHECK(t.tm_mday == 29);
+    CHECK(t.tm_hour == 12);
+    CHECK(t.tm_min == 34);
+    CHECK(t.tm_sec == 56);
+    CHECK(ind == i_null);
+
+    CHECK_THROWS_AS((sql << "select n from soci_test", into(n)), soci_error&);
+
+    // No rows.
+    i = 0;
+    sql << "select i from soci_test where i = 0", into(i);
+    CHECK(!sql.got_data());
+
+    // Affected rows are reported as usual.
+    statement st = (sql.prepare << "update soci_test set n = 1");
+    st.execute(true);
+    CHECK(st.get_affected_rows() == 1);
+
+    // The same query with parameters uses the prepared statements protocol
+    // and must give the same results.
+    int one = 1;
+    s.clear();
+    sql << "select s from soci_test where n = :one", use(one), into(s);
+    CHECK(s == "foo");
+
+    // Results returned by the stored procedures must be discarded.
+    try { sql << "drop procedure soci_test_proc"; }
+    catch (soci_error const &) {}
+
+    sql << "create procedure soci_test_proc() "
+        "begin select 1; select 2; end";
+
+    i = 0;
+    sql << "call soci_test_proc()", into(i);
+    CHECK(i == 1);
+
+    // This would fail with "Commands out of sync" if the other results
+    // weren't discarded.
+    sql << "select 3", into(i);
+    CHECK(i == 3);
+
+    sql << "drop procedure soci_test_proc";
+
+    // Non-integer numbers are truncated when read into integers, as with
+    // prepared statements.
+    sql << "select avg(i) from (select 2 as i union all select 3) as t",
+        into(i);
+    CHECK(i == 2);
+
+    sql << "select 1.0", into(ll);
+    CHECK(ll == 1);
+
+    sql << "select -7.9e0", into(i);
+    CHECK(i == -7);
+
+    CHECK_THROWS_AS((sql << "select 1e20", into(ll)), soci_error&);
+    CHECK_THROWS_AS((sql << "select -1.5", into(ull)), soci_error&);
+}
+
+struct result_mode_table_creator : table_creator_base
+{
+    result_mode_table_creator(soci::session & sql)
+        : table_creator_base(sql)
+    {
+        sql << "create table soci_test(id integer, s varchar(20))";
+    }
+};
+
+void check_result_mode(soci::session& sql, mysql_result_mode mode)
+{
+    std::vector<int> ids(7);
+    std::vector<std::string> strs(7);
+    statement st = (sql.prepare <<
+        "select id, s from soci_test order by id", into(ids), into(strs));
+
+    mysql_statement_backend* const backend =
+        static_cast<mysql_statement_backend*>(st.get_backend());
+    backend->set_result_mode(mode);
+
+    // Execute the statement twice to check that the state is correctly
+    // reset between the executions.
+    for (int n = 0; n != 2; ++n)
+    {
+        int count = 0;
+        st.execute();
+        while (st.fetch())
+        {
+            for (std::size_t i = 0; i != ids.size(); ++i)
+            {
+                CHECK(ids[i] == count);
+                CHECK(strs[i] == std::string(count % 20, 'x'));
+                ++count;
+            }
+        }
+
+        CHECK(count == 100);
+    }
+}
+
+TEST_CASE("MySQL result modes", "[mysql][result-mode]")
+{
+    soci::session sql(backEnd, connectString);
+    result_mode_table_creator tableCreator(sql);
+
+    std::vector<int> ids;
+    std::vector<std::string> strs;
+    for (int i = 0; i != 100; ++i)
+    {
+        ids.push_back(i);
+        strs.push_back(std::string(i % 20, 'x'));
+    }
+
+    sql << "insert into soci_test(id, s) values(:id, :s)", use(ids), use(strs);
+
+    mysql_session_backend* const sessionBackend =
+        static_cast<mysql_session_backend*>(sql.get_backend());
+    CHECK(sessionBackend->get_result_mode() == mysql_result_cursor);
+
+    SECTION("Cursor")
+    {
+        check_result_mode(sql, mysql_result_cursor);
+    }
+
+    SECTION("Buffered")
+    {
+        check_result_mode(sql, mysql_result_buffered);
+    }
+
+    SECTION("Unbuffered")
+    {
+        check_result_mode(sql, mysql_result_unbuffered);
+    }
+
+    SECTION("Session default")
+    {
+        sessionBackend->set_result_mode(mysql_result_buffered);
+
+        std::vector<int> v(10);
+        statement st = (sql.prepare << "select id from soci_test", into(v));
+        CHECK(static_cast<mysql_statement_backend*>(st.get_backend())
+                ->get_result_mode() == mysql_result_buffered);
+
+        st.execute(true);
+        CHECK(v.size() == 10);
+    }
+
+    SECTION("Connection option")
+    {
+        soci::session sql2(backEnd, connectString + " result_mode=unbuffered");
+        CHECK(static_cast<mysql_session_backend*>(sql2.get_backend())
+                ->get_result_mode() == mysql_result_unbuffered);
+
+        CHECK_THROWS_AS(soci::session(backEnd, connectString + " result_mode=foo"),
+                        soci_error&);
+    }
+}
+
+struct bulk_load_table_creator : table_creator_base
+{
+    bulk_load_table_creator(soci::session & sql)
+        : table_creator_base(sql)
+    {
+        sql << "create table soci_test(id integer, ull bigint unsigned, "
+            "d double, c char(1), s varchar(20), t datetime)";
+    }
+};
+
+TEST_CASE("MySQL bulk loader", "[mysql][bulk-load]")
+{
+    soci::session sql(backEnd, connectString + " local_infile=1");
+    bulk_load_table_creator tableCreator(sql);
+
+    std::vector<int> ids;
+    std::vector<unsigned long long> ulls;
+    std::vector<double> ds;
+    std::vector<char> cs;
+    std::vector<std::string> strs;
+    std::vector<indicator> strInds;
+    std::vector<std::tm> ts;
+
+    int const rows = 10000;
+    for (int i = 0; i != rows; ++i)
+    {
+        ids.push_back(i);
+        ulls.push_back(18446744073709551615ULL - i);
+        ds.push_back(i / 3.0);
+        cs.push_back(static_cast<char>('a' + i % 26));
+
+        std::ostringstream oss;
+        oss << "row " << i;
+        strs.push_back(oss.str());
+        strInds.push_back(i % 10 ? i_ok : i_null);
+
+        std::tm t = std::tm();
+        t.tm_year = 120;
+        t.tm_mon = i % 12;
+        t.tm_mday = 1 + i % 28;
+        t.tm_hour = i % 24;
+        t.tm_min = i % 60;
+        t.tm_sec = 59 - i % 60;
+        ts.push_back(t);
+    }
+
+    // Check that all the characters which need to be escaped are handled.
+    strs[1] = std::string("a\tb\nc\\d\re\0f\\N", 13);
+    cs[2] = '\t';
+
+    mysql_bulk_loader loader(sql, "soci_test");
+    loader.add("id", ids);
+    loader.add("ull", ulls);
+    loader.add("d", ds);
+    loader.add("c", cs);
+    loader.add("s", strs, strInds);
+    loader.add("t", ts);
+
+    CHECK(loader.load() == rows);
+    CHECK(loader.get_warning_count() == 0);
+
+    int count = 0;
+    sql << "select count(*) from soci_test", into(count);
+    CHECK(count == rows);
+
+    sql << "select count(*) from soci_test where s is null", into(count);
+    CHECK(count == rows / 10);
+
+    std::string s;
+    sql << "select s from soci_test where id = 1", into(s);
+    CHECK(s == strs[1]);
+
+    // Compare with the values read back in bulk.
+    std::vector<int> ids2(rows);
+    std::vector<unsigned long long> ulls2(rows);
+    std::vector<double> ds2(rows);
+    std::vector<std::string> cs2(rows);
+    std::vector<std::string> strs2(rows);
+    std::vector<indicator> strInds2(rows);
+    std::vector<std::tm> ts2(rows);
+    sql << "select id, ull, d, c, s, t from soci_test order by id",
+        into(ids2), into(ulls2), into(ds2), into(cs2), into(strs2, strInds2),
+        into(ts2);
+    REQUIRE(ids2.size() == static_cast<std::size_t>(rows));
+
+    for (int i = 0; i != rows; ++i)
+    {
+        CHECK(ids2[i] == i);
+        CHECK(ulls2[i] == ulls[i]);
+        CHECK(ds2[i] == ds[i]);
+        CHECK(cs2[i] == std::string(1, cs[i]));
+        CHECK(strInds2[i] == strInds[i]);
+        if (strInds[i] == i_ok)
+        {
+            CHECK(strs2[i] == strs[i]);
+        }
+        CHECK(ts2[i].tm_mon == ts[i].tm_mon);
+        CHECK(ts2[i].tm_mday == ts[i].tm_mday);
+        CHECK(ts2[i].tm_hour == ts[i].tm_hour);
+        CHECK(ts2[i].tm_sec == ts[i].tm_sec);
+    }
+
+    SECTION("Different sizes")
+    {
+        std::vector<int> shorter(3);
+
+        mysql_bulk_loader loader2(sql, "soci_test");
+        loader2.add("id", ids);
+        loader2.add("ull", shorter);
+        CHECK_THROWS_AS(loader2.load(), soci_error&);
+
+        std::vector<indicator> shorterInds(3);
+
+        mysql_bulk_loader loader3(sql, "soci_test");
+        loader3.add("s", strs, shorterInds);
+        CHECK_THROWS_AS(loader3.load(), soci_error&);
+    }
+
+    SECTION("Error")
+    {
+        mysql_bulk_loader loader2(sql, "soci_test");
+        loader2.add("no_such_column", ids);
+        CHECK_THROWS_AS(loader2.load(), mysql_soci_error&);
+
+        // The session must still be usable after an error.
+        sql << "select count(*) from soci_test", into(count);
+        CHECK(count == rows);
+    }
+
+    SECTION("Quoted names")
+    {
+        // Use reserved words, spaces and backticks in the names.
+        sql << "create table `soci ``test``` "
+               "(`order` integer, `a b` varchar(10))";
+
+        std::vector<std::string> names(rows, "x");
+        mysql_bulk_loader loader2(sql, "soci `test`");
+        loader2.add("order", ids);
+        loader2.add("a b", names);
+        CHECK(loader2.load() == rows);
+
+        sql << "select count(*) from `soci ``test``` where `a b` = 'x'",
+            into(count);
+        CHECK(count == rows);
+
+        sql << "drop table `soci ``test```";
+    }
+}
+
+TEST_CASE("MySQL timeout and cancel", "[mysql][timeout][cancel]")
+{
+    soci::session sql(backEnd, connectString);
+
+    // Don't use sleep() here as it just returns 1 when it's interrupted.
+    int n = 0;
+    statement st = (sql.prepare <<
+                    "select benchmark(10000000000, md5('soci'))", into(n));
+    st.set_timeout(100);
+
+    try
+    {
+        st.execute(true);
+        FAIL("Expected exception not thrown");
+    }
+    catch (soci_error const& e)
+    {
+        CHECK(e.get_error_category() == soci_error::query_cancelled);
+    }
+
+    // Cancelling when nothing is executed does nothing.
+    sql.cancel();
+
+    sql << "select 17", into(n);
+    CHECK(n == 17);
+}
+
 std::string escape_string(soci::session& sql, const std::string& s)
 {
     mysql_session_backend* backend = static_cast<mysql_session_backend*>(
@@ -9,7 +9,9 @@
 #include "soci/odbc/soci-odbc.h"
 #include "common-tests.h"
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <vector>
 #include <ctime>
 #include <cmath>
 
@@ -75,6 +77,215 @@ TEST_CASE("MS SQL long string", "[odbc][mssql][long]")
     );
 }
 
+TEST_CASE("MS SQL vector of long strings", "[odbc][mssql][long][vector]")
+{
+    soci::session sql(backEnd, connectString);
+
+    struct long_text_table_creator : public table_creator_base
+    {
+        explicit long_text_table_creator(soci::session& sql)
+            : table_creator_base(sql)
+        {
+            // The column after the long one checks that it is still fetched
+            // correctly even if the driver doesn't support calling
+            // SQLGetData() for the columns before the bound ones.
+            sql << "create table soci_test ("
+                        "id integer, "
+                        "long_text nvarchar(max) null, "
+                        "n integer"
+                    ")";
+        }
+    } long_text_table_creator(sql);
+
+    // Use a value longer than the chunk used for retrieving long values to
+    // check that they're correctly reassembled.
+    std::string const str_long(3 * soci::details::odbc_get_data_chunk_size / 2, 'x');
+
+    int const count = 10;
+    for (int i = 0; i != count; ++i)
+    {
+        std::string const str = i % 2 ? str_long : std::string("short");
+        indicator ind = i % 3 ? i_ok : i_null;
+        int const n = i * 10;
+        sql << "insert into soci_test(id, long_text, n) values(:id, :s, :n)",
+            use(i), use(str, ind), use(n);
+    }
+
+    // Fetch the rows in batches smaller than the total number of them.
+    std::vector<int> ids(4);
+    std::vector<std::string> strs(4);
+    std::vector<indicator> inds(4);
+    std::vector<int> ns(4);
+    statement st = (sql.prepare <<
+        "select id, long_text, n from soci_test order by id",
+        into(ids), into(strs, inds), into(ns));
+    st.execute();
+
+    int row = 0;
+    while (st.fetch())
+    {
+        for (std::size_t i = 0; i != ids.size(); ++i, ++row)
+        {
+            CHECK(ids[i] == row);
+            CHECK(ns[i] == row * 10);
+
+            if (row % 3)
+            {
+                REQUIRE(inds[i] == i_ok);
+                if (row % 2)
+                {
+                    // See the comment in the test above.
+                    CHECK(strs[i].length() == str_long.length());
+                    CHECK(strs[i] == str_long);
+                }
+                else
+                {
+                    CHECK(strs[i] == "short");
+                }
+            }
+            else
+            {
+                CHECK(inds[i] == i_null);
+            }
+        }
+    }
+
+    CHECK(row == count);
+}
+
+// Struct used for testing odbc_row_fetcher.
+struct fixed_row
+{
+    int id;
+    char name[16];
+    SQLLEN nameInd;
+    double d;
+    TIMESTAMP_STRUCT ts;
+};
+
+namespace soci
+{
+
+template <>
+struct odbc_row_traits<fixed_row>
+{
+    static void describe(odbc_row_description<fixed_row> & d)
+    {
+        d.add(&fixed_row::id);
+        d.add(&fixed_row::name, &fixed_row::nameInd);
+        d.add(&fixed_row::d);
+        d.add(&fixed_row::ts);
+    }
+};
+
+} // namespace soci
+
+TEST_CASE("MS SQL row-wise fetch", "[odbc][mssql][bulk]")
+{
+    soci::session sql(backEnd, connectString);
+
+    struct row_table_creator : public table_creator_base
+    {
+        explicit row_table_creator(soci::session& sql)
+            : table_creator_base(sql)
+        {
+            sql << "create table soci_test ("
+                        "id integer, "
+                        "name varchar(15) null, "
+                        "d float, "
+                        "ts datetime"
+                    ")";
+        }
+    } row_table_creator(sql);
+
+    int const count = 10;
+    for (int i = 0; i != count; ++i)
+    {
+        std::ostringstream os;
+        os << "name " << i;
+        std::string const name = os.str();
+        indicator ind = i % 4 ? i_ok : i_null;
+        double const d = i / 2.0;
+
+        std::tm t = std::tm();
+        t.tm_year = 120;
+        t.tm_mon = 1;
+        t.tm_mday = i + 1;
+        t.tm_hour = i;
+
+        sql << "insert into soci_test(id, name, d, ts) "
+               "values(:id, :name, :d, :ts)",
+            use(i), use(name, ind), use(d), use(t);
+    }
+
+    statement st = (sql.prepare <<
+        "select id, name, d, ts from soci_test order by id");
+    st.execute();
+
+    // Fetch the rows in batches smaller than the total number of them.
+    std::vector<fixed_row> rows(4);
+    odbc_row_fetcher<fixed_row> fetcher(st);
+
+    int row = 0;
+    while (fetcher.fetch(rows))
+    {
+        for (std::size_t i = 0; i != rows.size(); ++i, ++row)
+        {
+            fixed_row const& r = rows[i];
+
+            CHECK(r.id == row);
+            if (row % 4)
+            {
+                std::ostringstream os;
+                os << "name " << row;
+                CHECK(r.nameInd == static_cast<SQLLEN>(os.str().length()));
+                CHECK(std::string(r.name) == os.str());
+            }
+            else
+            {
+                CHECK(r.nameInd == SQL_NULL_DATA);
+            }
+
+            CHECK(r.d == row / 2.0);
+            CHECK(r.ts.year == 2020);
+            CHECK(r.ts.month == 2);
+            CHECK(r.ts.day == row + 1);
+            CHECK(r.ts.hour == row);
+        }
+
+        // Restore the vector size, as the last fetch may have shrunk it.
+        rows.resize(4);
+    }
+
+    CHECK(row == count);
+}
+
+TEST_CASE("MS SQL query timeout", "[odbc][mssql][timeout]")
+{
+    soci::session sql(backEnd, connectString);
+
+    // ODBC timeouts are in seconds, so the smallest one is one second.
+    statement st = (sql.prepare << "waitfor delay '00:00:10'");
+    st.set_timeout(1);
+
+    try
+    {
+        st.execute(true);
+        FAIL("Expected exception not thrown");
+    }
+    catch (soci_error const& e)
+    {
+        CHECK(e.get_error_category() == soci_error::query_cancelled);
+    }
+
+    // Cancelling when nothing is executed does nothing.
+    sql.cancel();
+
+    int n = 0;
+    sql << "select 17", into(n);
+    CHECK(n == 17);
+}
+
 // DDL Creation objects for common tests
 struct table_creator_one : public table_creator_base
 {
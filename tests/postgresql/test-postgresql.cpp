@@ -677,6 +677,76 @@ TEST_CASE("PostgreSQL statement prepare failure", "[postgresql][prepare]")
     }
 }
 
+TEST_CASE("PostgreSQL statement timeout", "[postgresql][timeout]")
+{
+    soci::session sql(backEnd, connectString);
+
+    statement st = (sql.prepare << "select pg_sleep(10)");
+    st.set_timeout(100);
+
+    try
+    {
+        st.execute(true);
+        FAIL("expected exception not thrown");
+    }
+    catch (soci_error const& e)
+    {
+        CHECK(e.get_error_category() == soci_error::query_cancelled);
+    }
+
+    // Statements without timeout don't use the one set above.
+    st.set_timeout(0);
+    std::string timeout;
+    sql << "show statement_timeout", into(timeout);
+    CHECK(timeout == "0");
+
+    // Cancelling when nothing is executed does nothing.
+    sql.cancel();
+
+    int n = 0;
+    sql << "select 17", into(n);
+    CHECK(n == 17);
+}
+
+TEST_CASE("PostgreSQL async execution", "[postgresql][async]")
+{
+    soci::session sql(backEnd, connectString);
+
+    CHECK(sql.native_socket() >= 0);
+
+    int n = 0;
+    int const x = 17;
+    statement st = (sql.prepare << "select :x from pg_sleep(0.1)",
+                    use(x), into(n));
+
+    async_result res = st.execute_async(true);
+
+    // The query takes some time, so it shouldn't be ready immediately, but
+    // don't check for this to avoid spurious failures.
+    while (!res.is_ready())
+    {
+        // A real program would wait for the socket to become readable here.
+    }
+
+    CHECK(res.get());
+    CHECK(n == 17);
+
+    // Errors are reported by get().
+    statement bad = (sql.prepare << "select 1/0", into(n));
+    async_result resBad = bad.execute_async(true);
+    CHECK_THROWS_AS(resBad.get(), postgresql_soci_error&);
+
+    // Fetching from an already executed statement works too.
+    std::vector<int> v(3);
+    statement st2 = (sql.prepare << "select generate_series(1, 5)", into(v));
+    CHECK(st2.execute_async(true).get());
+    CHECK(v.size() == 3);
+    CHECK(st2.fetch_async().get());
+    CHECK(v.size() == 2);
+    CHECK(v[1] == 5);
+    CHECK_FALSE(st2.fetch_async().get());
+}
+
 // Test the support of PostgreSQL-style casts with ORM
 TEST_CASE("PostgreSQL ORM cast", "[postgresql][orm]")
 {
@@ -12,6 +12,7 @@
 #include <sstream>
 #include <string>
 #include <cmath>
+#include <cstdio>
 #include <cstring>
 #include <ctime>
 
@@ -105,6 +106,111 @@ TEST_CASE("SQLite blob", "[sqlite][blob]")
     }
 }
 
+TEST_CASE("SQLite incremental blob", "[sqlite][blob]")
+{
+    soci::session sql(backEnd, connectString);
+
+    blob_table_creator tableCreator(sql);
+
+    sql << "insert into soci_test(id, img) values(1, '')";
+
+    long long rowid = 0;
+    sql << "select rowid from soci_test where id = 1", into(rowid);
+
+    std::size_t const chunkSize = 1000;
+    std::size_t const numChunks = 100;
+    std::vector<char> chunk(chunkSize);
+
+    // Preallocate the blob and fill it by appending chunks to it.
+    {
+        blob b(sql);
+        sqlite3_blob_backend* const bbe
+            = static_cast<sqlite3_blob_backend*>(b.get_backend());
+
+        bbe->create("soci_test", "img", rowid, chunkSize * numChunks);
+        CHECK(bbe->is_open());
+        CHECK(b.get_len() == chunkSize * numChunks);
+
+        for (std::size_t n = 0; n != numChunks; ++n)
+        {
+            std::fill(chunk.begin(), chunk.end(), static_cast<char>('a' + n % 26));
+            CHECK(b.append(&chunk[0], chunkSize) == (n + 1) * chunkSize);
+        }
+
+        // The size of the blob can't be changed.
+        CHECK_THROWS_AS(b.append(&chunk[0], 1), soci_error&);
+        CHECK_THROWS_AS(b.trim(10), soci_error&);
+
+        // And it can't be used as a parameter.
+        CHECK_THROWS_AS((sql << "insert into soci_test(id, img) values(2, ?)",
+                         use(b)), soci_error&);
+
+        // But it can be overwritten.
+        b.write_from_start("xyz", 3, 1);
+    }
+
+    // Check that the data was written to the database.
+    {
+        blob b(sql);
+        sql << "select img from soci_test where id = 1", into(b);
+        REQUIRE(b.get_len() == chunkSize * numChunks);
+
+        char buf[4];
+        CHECK(b.read_from_start(buf, 4) == 4);
+        CHECK(std::strncmp(buf, "axyz", 4) == 0);
+
+        CHECK(b.read_from_start(buf, 4, (numChunks - 1) * chunkSize) == 4);
+        CHECK(std::strncmp(buf, "vvvv", 4) == 0);
+    }
+
+    // And read it back incrementally.
+    {
+        blob b(sql);
+        sqlite3_blob_backend* const bbe
+            = static_cast<sqlite3_blob_backend*>(b.get_backend());
+
+        bbe->open("soci_test", "img", rowid, true);
+        REQUIRE(b.get_len() == chunkSize * numChunks);
+
+        CHECK(b.read(chunkSize * 25, &chunk[0], chunkSize) == chunkSize);
+        CHECK(chunk[0] == 'z');
+        CHECK(chunk[chunkSize - 1] == 'z');
+
+        // Reading past the end returns only the available data.
+        CHECK(b.read(chunkSize * numChunks - 10, &chunk[0], chunkSize) == 10);
+
+        CHECK_THROWS_AS(b.write(0, "x", 1), soci_error&);
+
+        bbe->close();
+        CHECK(!bbe->is_open());
+        CHECK(b.get_len() == 0);
+    }
+
+    {
+        blob b(sql);
+        sqlite3_blob_backend* const bbe
+            = static_cast<sqlite3_blob_backend*>(b.get_backend());
+        CHECK_THROWS_AS(bbe->open("soci_test", "img", rowid + 100), soci_error&);
+        CHECK_THROWS_AS(bbe->create("soci_test", "img", rowid + 100, 10), soci_error&);
+    }
+
+    // Names containing quotes must work too.
+    {
+        sql << "create table \"soci \"\"test\"\"\"(\"i\"\"mg\" blob)";
+        sql << "insert into \"soci \"\"test\"\"\" values('')";
+        sql << "select max(rowid) from \"soci \"\"test\"\"\"", into(rowid);
+
+        blob b(sql);
+        sqlite3_blob_backend* const bbe
+            = static_cast<sqlite3_blob_backend*>(b.get_backend());
+        bbe->create("soci \"test\"", "i\"mg", rowid, 10);
+        CHECK(b.get_len() == 10);
+        bbe->close();
+
+        sql << "drop table \"soci \"\"test\"\"\"";
+    }
+}
+
 // This test was put in to fix a problem that occurs when there are both
 // into and use elements in the same query and one of them (into) binds
 // to a vector object.
@@ -237,6 +343,398 @@ TEST_CASE("SQLite vector long long", "[sqlite][vector][longlong]")
     CHECK(v2[4] == 1000000000000LL);
 }
 
+struct vector_strings_table_creator : table_creator_base
+{
+    vector_strings_table_creator(soci::session & sql)
+        : table_creator_base(sql)
+    {
+        sql << "create table soci_test(id integer, str varchar(100), tm datetime)";
+    }
+};
+
+// Check that the data of the rows fetched in several batches doesn't get
+// mixed up as the same buffers are reused for all of them.
+TEST_CASE("SQLite vector strings in batches", "[sqlite][vector][string]")
+{
+    soci::session sql(backEnd, connectString);
+
+    vector_strings_table_creator tableCreator(sql);
+
+    std::vector<int> ids;
+    std::vector<std::string> strs;
+    std::vector<indicator> inds;
+    for (int i = 0; i != 10; ++i)
+    {
+        ids.push_back(i);
+        strs.push_back(std::string(i * 7, static_cast<char>('a' + i)));
+        inds.push_back(i % 3 == 2 ? i_null : i_ok);
+    }
+
+    sql << "insert into soci_test(id, str, tm) "
+           "values(:id, :str, '2026-01-02 03:04:05')",
+           use(ids), use(strs, inds);
+
+    std::vector<int> ids2(4);
+    std::vector<std::string> strs2(4);
+    std::vector<indicator> inds2(4);
+    std::vector<std::tm> tms(4);
+    statement st = (sql.prepare <<
+        "select id, str, tm from soci_test order by id",
+        into(ids2), into(strs2, inds2), into(tms));
+    st.execute();
+
+    int count = 0;
+    while (st.fetch())
+    {
+        REQUIRE(strs2.size() == ids2.size());
+        for (std::size_t n = 0; n != ids2.size(); ++n, ++count)
+        {
+            CHECK(ids2[n] == count);
+            CHECK(tms[n].tm_year == 126);
+            CHECK(tms[n].tm_sec == 5);
+
+            if (count % 3 == 2)
+            {
+                CHECK(inds2[n] == i_null);
+            }
+            else
+            {
+                CHECK(inds2[n] == i_ok);
+                CHECK(strs2[n] == strs[count]);
+            }
+        }
+    }
+
+    CHECK(count == 10);
+}
+
+// Check that vectors are bound correctly when the statement is executed
+// several times, as the buffers used for the dates are reused.
+TEST_CASE("SQLite vector use re-execution", "[sqlite][vector][use]")
+{
+    soci::session sql(backEnd, connectString);
+
+    vector_strings_table_creator tableCreator(sql);
+
+    std::vector<int> ids(3);
+    std::vector<std::string> strs(3);
+    std::vector<std::tm> tms(3);
+    std::vector<indicator> inds(3, i_ok);
+
+    statement st = (sql.prepare <<
+        "insert into soci_test(id, str, tm) values(:id, :str, :tm)",
+        use(ids), use(strs), use(tms, inds));
+
+    for (int n = 0; n != 2; ++n)
+    {
+        for (int i = 0; i != 3; ++i)
+        {
+            ids[i] = n * 3 + i;
+            strs[i] = std::string(ids[i] + 1, 'x');
+
+            std::tm t = std::tm();
+            t.tm_year = 100 + ids[i];
+            t.tm_mon = 11;
+            t.tm_mday = 31;
+            tms[i] = t;
+        }
+
+        inds[1] = n ? i_ok : i_null;
+
+        st.execute(true);
+        CHECK(st.get_affected_rows() == 3);
+    }
+
+    std::vector<int> ids2(10);
+    std::vector<std::string> strs2(10);
+    std::vector<std::string> tms2(10);
+    std::vector<indicator> inds2(10);
+    sql << "select id, str, tm from soci_test order by id",
+        into(ids2), into(strs2), into(tms2, inds2);
+
+    REQUIRE(ids2.size() == 6);
+    for (int i = 0; i != 6; ++i)
+    {
+        CHECK(ids2[i] == i);
+        CHECK(strs2[i] == std::string(i + 1, 'x'));
+
+        if (i == 1)
+        {
+            CHECK(inds2[i] == i_null);
+        }
+        else
+        {
+            std::ostringstream oss;
+            oss << 2000 + i << "-12-31 00:00:00";
+            CHECK(tms2[i] == oss.str());
+        }
+    }
+}
+
+struct key_value_table_creator : table_creator_base
+{
+    key_value_table_creator(soci::session & sql)
+        : table_creator_base(sql)
+    {
+        sql << "create table soci_test(k integer primary key, v)";
+    }
+};
+
+TEST_CASE("SQLite column view", "[sqlite][into][view]")
+{
+    soci::session sql(backEnd, connectString);
+
+    key_value_table_creator tableCreator(sql);
+
+    sql << "insert into soci_test(k, v) values(1, 'Hello, world')";
+    sql << "insert into soci_test(k, v) values(2, x'00010203')";
+    sql << "insert into soci_test(k, v) values(3, NULL)";
+    sql << "insert into soci_test(k, v) values(4, 17)";
+
+    sqlite3_column_view view;
+    indicator ind = i_ok;
+
+    CHECK_THROWS_AS(view.data(), soci_error&);
+
+    {
+        int k = 1;
+        statement st = (sql.prepare << "select v from soci_test where k = :k",
+                        use(k), into(view, ind));
+
+        REQUIRE(st.execute(true));
+        CHECK(ind == i_ok);
+        CHECK(view.str() == "Hello, world");
+        CHECK(view.size() == 12);
+        CHECK(view.data()[view.size()] == '\0');
+
+        k = 2;
+        REQUIRE(st.execute(true));
+        CHECK(ind == i_ok);
+        REQUIRE(view.size() == 4);
+        CHECK(std::memcmp(view.data(), "\0\1\2\3", 4) == 0);
+
+        k = 3;
+        REQUIRE(st.execute(true));
+        CHECK(ind == i_null);
+        CHECK(view.data() == NULL);
+        CHECK(view.size() == 0);
+
+        k = 4;
+        REQUIRE(st.execute(true));
+        CHECK(view.str() == "17");
+
+        // The view is invalidated if there is no data.
+        k = 5;
+        CHECK(!st.execute(true));
+        CHECK_THROWS_AS(view.size(), soci_error&);
+
+        // Without indicator NULL values result in an error.
+        sqlite3_column_view view2;
+        statement st2 = (sql.prepare << "select v from soci_test order by k",
+                         into(view2));
+        st2.execute();
+        REQUIRE(st2.fetch());
+        CHECK(view2.str() == "Hello, world");
+        REQUIRE(st2.fetch());
+        CHECK(view2.size() == 4);
+        CHECK_THROWS_AS(st2.fetch(), soci_error&);
+
+        k = 1;
+        REQUIRE(st.execute(true));
+        CHECK(view.size() == 12);
+    }
+
+    // The statement was destroyed, so the view can't be used any more.
+    CHECK_THROWS_AS(view.data(), soci_error&);
+
+    // And this is also the case for one-time queries.
+    sql << "select v from soci_test where k = 1", into(view);
+    CHECK_THROWS_AS(view.str(), soci_error&);
+}
+
+struct unique_ids_table_creator : table_creator_base
+{
+    unique_ids_table_creator(soci::session & sql)
+        : table_creator_base(sql)
+    {
+        sql << "create table soci_test(id integer primary key)";
+    }
+};
+
+// Bulk operations are executed in a savepoint by default, so they're either
+// executed completely or not at all.
+TEST_CASE("SQLite bulk transactions", "[sqlite][vector][use][transaction]")
+{
+    std::vector<int> ids;
+    ids.push_back(1);
+    ids.push_back(2);
+    ids.push_back(1); // duplicate, results in an error
+    ids.push_back(3);
+
+    SECTION("Default")
+    {
+        soci::session sql(backEnd, connectString);
+        unique_ids_table_creator tableCreator(sql);
+
+        statement st = (sql.prepare << "insert into soci_test(id) values(:id)",
+                        use(ids));
+        CHECK_THROWS_AS(st.execute(true), soci_error&);
+        CHECK(st.get_affected_rows() == 0);
+
+        int count = -1;
+        sql << "select count(*) from soci_test", into(count);
+        CHECK(count == 0);
+
+        // The savepoint must not affect the explicitly started transaction.
+        ids[2] = 4;
+        {
+            transaction tr(sql);
+            st.execute(true);
+            CHECK(st.get_affected_rows() == 4);
+            tr.rollback();
+        }
+
+        sql << "select count(*) from soci_test", into(count);
+        CHECK(count == 0);
+
+        st.execute(true);
+        CHECK(st.get_affected_rows() == 4);
+
+        sql << "select count(*) from soci_test", into(count);
+        CHECK(count == 4);
+    }
+
+    SECTION("Disabled")
+    {
+        soci::session sql(backEnd,
+                          "db=" + connectString + " bulk_transactions=false");
+        unique_ids_table_creator tableCreator(sql);
+
+        statement st = (sql.prepare << "insert into soci_test(id) values(:id)",
+                        use(ids));
+        CHECK_THROWS_AS(st.execute(true), soci_error&);
+
+        // The rows inserted before the error are preserved in this case.
+        int count = -1;
+        sql << "select count(*) from soci_test", into(count);
+        CHECK(count == 2);
+    }
+
+    SECTION("Invalid")
+    {
+        CHECK_THROWS_AS(soci::session(backEnd,
+                                      "db=" + connectString +
+                                      " bulk_transactions=maybe"),
+                        soci_error&);
+    }
+}
+
+TEST_CASE("SQLite statement cache", "[sqlite][statement-cache]")
+{
+    SECTION("Default")
+    {
+        soci::session sql(backEnd, connectString);
+        unique_ids_table_creator tableCreator(sql);
+
+        sqlite3_statement_cache & cache =
+            static_cast<sqlite3_session_backend *>(sql.get_backend())
+                ->statementCache_;
+
+        // Forget the statements used for creating the table.
+        cache.clear();
+        cache.reset_stats();
+
+        for (int i = 0; i != 3; ++i)
+        {
+            sql << "insert into soci_test(id) values(:id)", use(i);
+        }
+
+        CHECK(cache.get_stats().misses == 1);
+        CHECK(cache.get_stats().hits == 2);
+        CHECK(cache.size() == 1);
+
+        // Check that the cached statement doesn't keep the old values.
+        int count = 0;
+        sql << "select count(*) from soci_test", into(count);
+        CHECK(count == 3);
+
+        count = 0;
+        sql << "select count(*) from soci_test", into(count);
+        CHECK(count == 3);
+        CHECK(cache.get_stats().hits == 3);
+
+        // Two statements with the same SQL alive at the same time can't share
+        // the same prepared statement.
+        {
+            int id1 = 0, id2 = 0;
+            statement st1 = (sql.prepare << "select id from soci_test order by id",
+                             into(id1));
+            statement st2 = (sql.prepare << "select id from soci_test order by id",
+                             into(id2));
+            st1.execute();
+            st2.execute();
+            CHECK(st1.fetch());
+            CHECK(st1.fetch());
+            CHECK(st2.fetch());
+            CHECK(id1 == 1);
+            CHECK(id2 == 0);
+        }
+
+        CHECK(cache.size() == 4);
+    }
+
+    SECTION("Limited")
+    {
+        soci::session sql(backEnd,
+                          "db=" + connectString + " statement_cache_size=2");
+        unique_ids_table_creator tableCreator(sql);
+
+        sqlite3_statement_cache & cache =
+            static_cast<sqlite3_session_backend *>(sql.get_backend())
+                ->statementCache_;
+        CHECK(cache.get_max_size() == 2);
+
+        // Forget the statements used for creating the table.
+        cache.clear();
+        cache.reset_stats();
+
+        int n = 0;
+        sql << "select 1", into(n);
+        sql << "select 2", into(n);
+        sql << "select 3", into(n);
+        CHECK(n == 3);
+
+        CHECK(cache.size() == 2);
+        CHECK(cache.get_stats().evictions == 1);
+
+        // "select 1" was evicted, but the more recent statements were kept.
+        sql << "select 1", into(n);
+        sql << "select 3", into(n);
+        CHECK(cache.get_stats().misses == 4);
+        CHECK(cache.get_stats().hits == 1);
+    }
+
+    SECTION("Disabled")
+    {
+        soci::session sql(backEnd,
+                          "db=" + connectString + " statement_cache_size=0");
+
+        sqlite3_statement_cache & cache =
+            static_cast<sqlite3_session_backend *>(sql.get_backend())
+                ->statementCache_;
+        cache.reset_stats();
+
+        int n = 0;
+        sql << "select 1", into(n);
+        sql << "select 1", into(n);
+        CHECK(n == 1);
+
+        CHECK(cache.size() == 0);
+        CHECK(cache.get_stats().hits == 0);
+        CHECK(cache.get_stats().misses == 2);
+    }
+}
+
 struct type_inference_table_creator : table_creator_base
 {
     type_inference_table_creator(soci::session & sql)
@@ -275,6 +773,266 @@ TEST_CASE("SQLite type inference", "[sqlite][sequence]")
     }
 }
 
+struct unknown_types_table_creator : table_creator_base
+{
+    unknown_types_table_creator(soci::session & sql)
+        : table_creator_base(sql)
+    {
+        sql << "create table soci_test(id integer, n myint, d mynumber, s mytype)";
+    }
+};
+
+namespace
+{
+
+int g_rowsExamined = 0;
+
+// SQL function used for counting how many times the query is executed.
+void count_rows(sqlite_api::sqlite3_context* ctx, int, sqlite_api::sqlite3_value**)
+{
+    ++g_rowsExamined;
+    sqlite_api::sqlite3_result_int(ctx, 1);
+}
+
+} // anonymous namespace
+
+// Columns with unknown declared types are described using the values in the
+// first row, but without executing the query more than once.
+TEST_CASE("SQLite unknown column types", "[sqlite][rowset][type]")
+{
+    soci::session sql(backEnd, connectString);
+
+    unknown_types_table_creator tableCreator(sql);
+
+    sqlite_api::sqlite3* const conn =
+        static_cast<sqlite3_session_backend*>(sql.get_backend())->conn_;
+    REQUIRE(sqlite_api::sqlite3_create_function(conn, "soci_count_rows", 0,
+                                                SQLITE_UTF8, NULL, &count_rows,
+                                                NULL, NULL) == SQLITE_OK);
+
+    sql << "insert into soci_test(id, n, d, s) values(1, 17, 2.5, 'foo')";
+    sql << "insert into soci_test(id, n, d, s) values(2, 18, 3.5, 'bar')";
+
+    g_rowsExamined = 0;
+
+    int id = 2;
+    rowset<row> rs = (sql.prepare <<
+                        "select n, d, s from soci_test "
+                        "where soci_count_rows() and id = :id",
+                      use(id));
+
+    // Both rows are examined, but only once.
+    CHECK(g_rowsExamined == 2);
+
+    rowset<row>::const_iterator it = rs.begin();
+    REQUIRE(it != rs.end());
+
+    row const& r = *it;
+    CHECK(r.get_properties(0).get_data_type() == dt_integer);
+    CHECK(r.get_properties(1).get_data_type() == dt_double);
+    CHECK(r.get_properties(2).get_data_type() == dt_string);
+    CHECK(r.get<int>(0) == 18);
+    CHECK(r.get<double>(1) == Approx(3.5));
+    CHECK(r.get<std::string>(2) == "bar");
+
+    CHECK(++it == rs.end());
+
+    // Without any rows, the declared types are used to determine the types.
+    id = 3;
+    rowset<row> rsEmpty = (sql.prepare <<
+                            "select n, d, s from soci_test where id = :id",
+                           use(id));
+    CHECK(rsEmpty.begin() == rsEmpty.end());
+
+    statement st = (sql.prepare << "select n, d, s from soci_test where id = 3");
+    row r2;
+    st.exchange(into(r2));
+    st.define_and_bind();
+    CHECK(!st.execute(true));
+    CHECK(r2.get_properties(0).get_data_type() == dt_integer);
+    CHECK(r2.get_properties(1).get_data_type() == dt_string);
+    CHECK(r2.get_properties(2).get_data_type() == dt_string);
+}
+
+// Helper removing the database file, and the files used by SQLite in WAL
+// mode, on scope exit.
+struct wal_database_remover
+{
+    explicit wal_database_remover(std::string const& name) : name_(name) {}
+
+    ~wal_database_remover()
+    {
+        std::remove(name_.c_str());
+        std::remove((name_ + "-wal").c_str());
+        std::remove((name_ + "-shm").c_str());
+    }
+
+    std::string const name_;
+};
+
+TEST_CASE("SQLite WAL pool", "[sqlite][pool]")
+{
+    std::string const dbname = "soci_test_wal.sqlite";
+    wal_database_remover remover(dbname);
+
+    {
+        sqlite3_wal_pool pool(dbname, 2);
+
+        {
+            session sql(pool.writer());
+            sql << "create table soci_test(id integer, name varchar(100))";
+            sql << "insert into soci_test(id, name) values(1, 'foo')";
+
+            std::string mode;
+            sql << "pragma journal_mode", into(mode);
+            CHECK(mode == "wal");
+        }
+
+        session reader1(pool.readers());
+        session reader2(pool.readers());
+
+        // Both readers can be used concurrently.
+        int id = 0;
+        std::string name;
+        statement st1 = (reader1.prepare << "select id from soci_test", into(id));
+        statement st2 = (reader2.prepare << "select name from soci_test", into(name));
+        st1.execute();
+        st2.execute();
+        CHECK(st1.fetch());
+        CHECK(st2.fetch());
+        CHECK(id == 1);
+        CHECK(name == "foo");
+
+        // And the writer can modify the database in the meanwhile.
+        {
+            session sql(pool.writer());
+            sql << "insert into soci_test(id, name) values(2, 'bar')";
+        }
+
+        long long mmapSize = 0;
+        reader1 << "pragma mmap_size", into(mmapSize);
+        CHECK(mmapSize > 0);
+
+        CHECK_THROWS_AS(reader1 << "delete from soci_test", soci_error&);
+    }
+
+    // The pool can't be used with in-memory databases.
+    CHECK_THROWS_AS(sqlite3_wal_pool(":memory:", 1), soci_error&);
+
+    // Only simple values of the pragmas are accepted.
+    CHECK_THROWS_AS(soci::session(backEnd,
+                                  "db=" + connectString +
+                                  " cache_size=1;drop"),
+                    soci_error&);
+}
+
+struct backup_progress : sqlite3_backup_progress
+{
+    backup_progress() : steps_(0), remaining_(-1), total_(0) {}
+
+    void on_step(int remaining, int total) SOCI_OVERRIDE
+    {
+        ++steps_;
+        remaining_ = remaining;
+        total_ = total;
+    }
+
+    int steps_;
+    int remaining_;
+    int total_;
+};
+
+TEST_CASE("SQLite backup", "[sqlite][backup]")
+{
+    soci::session src(backEnd, ":memory:");
+    src << "create table soci_test(id integer, name varchar(100))";
+
+    std::vector<int> ids;
+    std::vector<std::string> names;
+    for (int i = 0; i != 1000; ++i)
+    {
+        ids.push_back(i);
+        names.push_back(std::string(100, static_cast<char>('a' + i % 26)));
+    }
+    src << "insert into soci_test(id, name) values(:id, :name)",
+           use(ids), use(names);
+
+    SECTION("Between sessions")
+    {
+        soci::session dst(backEnd, ":memory:");
+        dst << "create table other(x integer)";
+
+        sqlite3_backup_copy backup(dst, src);
+        CHECK(!backup.done());
+
+        // Copy one page at a time.
+        CHECK(!backup.step(1));
+        CHECK(backup.page_count() > 2);
+        CHECK(backup.remaining() == backup.page_count() - 1);
+
+        backup_progress progress;
+        backup.run(1, 0, &progress);
+        CHECK(backup.done());
+        CHECK(progress.steps_ == backup.page_count() - 1);
+        CHECK(progress.remaining_ == 0);
+        CHECK(progress.total_ == backup.page_count());
+
+        // Further steps don't do anything.
+        CHECK(backup.step());
+
+        int count = 0;
+        dst << "select count(*) from soci_test", into(count);
+        CHECK(count == 1000);
+
+        // The destination database contents was replaced.
+        CHECK_THROWS_AS(dst << "select count(*) from other", soci_error&);
+    }
+
+    SECTION("Save and load")
+    {
+        std::string const dbname = "soci_test_backup.sqlite";
+        wal_database_remover remover(dbname);
+
+        {
+            sqlite3_backup_copy backup(src, dbname,
+                                       sqlite3_backup_copy::save_to_file);
+            backup.run();
+            CHECK(backup.done());
+        }
+
+        soci::session dst(backEnd, ":memory:");
+        {
+            sqlite3_backup_copy backup(dst, dbname,
+                                       sqlite3_backup_copy::load_from_file);
+            CHECK(backup.step());
+        }
+
+        std::string name;
+        dst << "select name from soci_test where id = 27", into(name);
+        CHECK(name == std::string(100, 'b'));
+
+        CHECK_THROWS_AS(sqlite3_backup_copy(dst, "no/such/dir/file.sqlite",
+                                            sqlite3_backup_copy::load_from_file),
+                        soci_error&);
+    }
+
+    SECTION("Busy destination")
+    {
+        // The backup can't be started while the destination is being read.
+        soci::session dst(backEnd, ":memory:");
+        dst << "create table t(x integer)";
+        dst << "insert into t(x) values(1)";
+        dst << "insert into t(x) values(2)";
+
+        int x = 0;
+        statement st = (dst.prepare << "select x from t", into(x));
+        st.execute();
+        REQUIRE(st.fetch());
+
+        CHECK_THROWS_AS(sqlite3_backup_copy(dst, src), soci_error&);
+    }
+}
+
 TEST_CASE("SQLite DDL wrappers", "[sqlite][ddl]")
 {
     soci::session sql(backEnd, connectString);
@@ -339,6 +1097,295 @@ TEST_CASE("SQLite std::tm bind", "[sqlite][std-tm-bind]")
     CHECK(std::mktime(&result.front()) == std::mktime(&datetime));
 }
 
+TEST_CASE("SQLite epoch dates", "[sqlite][std-tm-bind][epoch]")
+{
+    std::tm t = std::tm();
+    t.tm_year = 117;
+    t.tm_mon = 3;
+    t.tm_mday = 4;
+    t.tm_hour = 12;
+
+    std::tm old = std::tm();
+    old.tm_year = 65;
+    old.tm_mon = 11;
+    old.tm_mday = 31;
+    old.tm_hour = 23;
+    old.tm_min = 59;
+    old.tm_sec = 30;
+
+    SECTION("Seconds")
+    {
+        soci::session sql(backEnd,
+                          "db=" + connectString + " date_storage=epoch_seconds");
+        table_creator_for_std_tm_bind tableCreator(sql);
+        sql << "delete from soci_test";
+
+        sql << "insert into soci_test(date) values(:dt)", use(t);
+
+        std::string type;
+        long long value = 0;
+        sql << "select typeof(date), date from soci_test", into(type), into(value);
+        CHECK(type == "integer");
+        CHECK(value == 1491307200);
+
+        std::tm r = std::tm();
+        sql << "select date from soci_test", into(r);
+        CHECK(r.tm_year == 117);
+        CHECK(r.tm_mon == 3);
+        CHECK(r.tm_mday == 4);
+        CHECK(r.tm_hour == 12);
+        CHECK(r.tm_min == 0);
+        CHECK(r.tm_wday == 2);
+
+        // Comparisons work with the values bound in the same way.
+        int count = 0;
+        sql << "select count(*) from soci_test where date = :dt",
+               use(t), into(count);
+        CHECK(count == 1);
+
+        std::vector<std::tm> dates;
+        dates.push_back(old);
+        dates.push_back(t);
+        sql << "delete from soci_test";
+        sql << "insert into soci_test(date) values(:dt)", use(dates);
+
+        std::vector<std::tm> results(4);
+        sql << "select date from soci_test order by date", into(results);
+        REQUIRE(results.size() == 2);
+        CHECK(results[0].tm_year == 65);
+        CHECK(results[0].tm_mon == 11);
+        CHECK(results[0].tm_mday == 31);
+        CHECK(results[0].tm_hour == 23);
+        CHECK(results[0].tm_min == 59);
+        CHECK(results[0].tm_sec == 30);
+        CHECK(results[1].tm_mday == 4);
+
+        soci::rowset<soci::row> rs = (sql.prepare <<
+            "select date from soci_test order by date");
+        soci::rowset<soci::row>::const_iterator it = rs.begin();
+        REQUIRE(it != rs.end());
+        CHECK(it->get_properties(0).get_data_type() == dt_date);
+        CHECK(it->get<std::tm>(0).tm_year == 65);
+    }
+
+    SECTION("Microseconds")
+    {
+        soci::session sql(backEnd,
+                          "db=" + connectString +
+                          " date_storage=epoch_microseconds");
+        table_creator_for_std_tm_bind tableCreator(sql);
+        sql << "delete from soci_test";
+
+        sql << "insert into soci_test(date) values(:dt)", use(old);
+
+        long long value = 0;
+        sql << "select date from soci_test", into(value);
+        CHECK(value == -126230430LL * 1000000);
+
+        std::tm r = std::tm();
+        sql << "select date from soci_test", into(r);
+        CHECK(r.tm_year == 65);
+        CHECK(r.tm_sec == 30);
+    }
+
+    SECTION("Auto-detection")
+    {
+        // Integer values are read as dates even in the default text mode.
+        soci::session sql(backEnd, connectString);
+        table_creator_for_std_tm_bind tableCreator(sql);
+        sql << "delete from soci_test";
+        sql << "insert into soci_test(date) values(1491307200)";
+        sql << "insert into soci_test(date) values('2017-04-05 00:00:00')";
+
+        std::vector<std::tm> results(2);
+        sql << "select date from soci_test order by rowid", into(results);
+        REQUIRE(results.size() == 2);
+        CHECK(results[0].tm_mday == 4);
+        CHECK(results[0].tm_hour == 12);
+        CHECK(results[1].tm_mday == 5);
+        CHECK(results[1].tm_hour == 0);
+    }
+
+    SECTION("Invalid")
+    {
+        CHECK_THROWS_AS(soci::session(backEnd,
+                                      "db=" + connectString +
+                                      " date_storage=epoch_days"),
+                        soci_error&);
+    }
+}
+
+namespace
+{
+
+// Query taking a long time to execute, as it generates a billion rows.
+char const* const slowQuery =
+    "with recursive c(x) as (select 1 union all select x + 1 from c "
+    "where x < 1000000000) select count(*) from c";
+
+// SQL function cancelling the query using the session passed as user data.
+void cancel_query(sqlite_api::sqlite3_context* ctx, int, sqlite_api::sqlite3_value**)
+{
+    static_cast<soci::session*>(sqlite_api::sqlite3_user_data(ctx))->cancel();
+    sqlite_api::sqlite3_result_int(ctx, 1);
+}
+
+} // anonymous namespace
+
+TEST_CASE("SQLite timeout and cancel", "[sqlite][timeout][cancel]")
+{
+    soci::session sql(backEnd, connectString);
+
+    SECTION("Timeout")
+    {
+        int count = 0;
+        statement st = (sql.prepare << slowQuery, into(count));
+        st.set_timeout(100);
+
+        try
+        {
+            st.execute(true);
+            FAIL("Expected exception not thrown");
+        }
+        catch (soci_error const& e)
+        {
+            CHECK(e.get_error_category() == soci_error::query_cancelled);
+        }
+
+        // Without timeout, the statement can be executed normally again.
+        st.set_timeout(0);
+        sql << "select 17", into(count);
+        CHECK(count == 17);
+
+        CHECK_THROWS_AS(st.set_timeout(-1), soci_error&);
+    }
+
+    SECTION("Cancel")
+    {
+        // Cancelling from another thread is what this is meant for, but it's
+        // simpler and deterministic to cancel from inside the query itself.
+        sqlite_api::sqlite3* const conn =
+            static_cast<sqlite3_session_backend*>(sql.get_backend())->conn_;
+        REQUIRE(sqlite_api::sqlite3_create_function(conn, "soci_cancel", 0,
+                                                    SQLITE_UTF8, &sql,
+                                                    &cancel_query,
+                                                    NULL, NULL) == SQLITE_OK);
+
+        int count = 0;
+        try
+        {
+            sql << "with recursive c(x) as (select 1 union all select x + 1 "
+                   "from c where x < 1000000000 and (x != 1000 or soci_cancel())) "
+                   "select count(*) from c", into(count);
+            FAIL("Expected exception not thrown");
+        }
+        catch (soci_error const& e)
+        {
+            CHECK(e.get_error_category() == soci_error::query_cancelled);
+        }
+
+        sql << "select 42", into(count);
+        CHECK(count == 42);
+    }
+}
+
+TEST_CASE("SQLite async execution", "[sqlite][async]")
+{
+    soci::session sql(backEnd, connectString);
+
+    // There is no server to wait for with SQLite.
+    CHECK(sql.native_socket() == -1);
+
+    SECTION("Execute")
+    {
+        int count = 0;
+        statement st = (sql.prepare << "select 17", into(count));
+
+        async_result res = st.execute_async(true);
+        while (!res.is_ready())
+        {
+            // Nothing to do while waiting here.
+        }
+
+        CHECK(res.get());
+        CHECK(count == 17);
+        CHECK(st.got_data());
+        CHECK(sql.got_data());
+
+        CHECK_THROWS_AS(res.get(), soci_error&);
+    }
+
+    SECTION("Fetch")
+    {
+        sql << "create temp table soci_test(id integer)";
+        for (int i = 0; i != 5; ++i)
+        {
+            sql << "insert into soci_test(id) values(:id)", use(i);
+        }
+
+        std::vector<int> ids(2);
+        statement st = (sql.prepare << "select id from soci_test order by id",
+                        into(ids));
+        CHECK(st.execute_async().get() == false);
+
+        int sum = 0;
+        int fetched = 0;
+        while (st.fetch_async().get())
+        {
+            for (std::size_t i = 0; i != ids.size(); ++i)
+            {
+                sum += ids[i];
+                ++fetched;
+            }
+        }
+
+        CHECK(fetched == 5);
+        CHECK(sum == 10);
+        CHECK(!st.got_data());
+    }
+
+    SECTION("Error")
+    {
+        int count = 0;
+        statement st = (sql.prepare << slowQuery, into(count));
+        st.set_timeout(100);
+
+        async_result res = st.execute_async(true);
+        try
+        {
+            res.get();
+            FAIL("Expected exception not thrown");
+        }
+        catch (soci_error const& e)
+        {
+            CHECK(e.get_error_category() == soci_error::query_cancelled);
+        }
+    }
+
+    SECTION("Discard")
+    {
+        int count = 0;
+        statement st = (sql.prepare << "select 42", into(count));
+
+        {
+            async_result res = st.execute_async(true);
+        }
+
+        // The result is only stored by get().
+        CHECK(!st.got_data());
+
+        // And the handle can outlive the statement object.
+        async_result res = statement((sql.prepare << "select 7",
+                                      into(count))).execute_async(true);
+        CHECK(res.get());
+        CHECK(count == 7);
+
+        // The session can be used again after discarding the result.
+        sql << "select 23", into(count);
+        CHECK(count == 23);
+    }
+}
+
 // DDL Creation objects for common tests
 struct table_creator_one : public table_creator_base
 {
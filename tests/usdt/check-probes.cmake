@@ -0,0 +1,43 @@
+###############################################################################
+#
+# This file is part of CMake configuration for SOCI library
+#
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+#
+###############################################################################
+
+# Verify that all the expected USDT probes are present in the SDT notes of the
+# library given by LIBRARY variable using READELF.
+#
+# The list of probes must be kept in sync with include/private/soci-usdt.h.
+
+set(SOCI_EXPECTED_PROBES
+  prepare
+  execute_begin
+  execute_end
+  fetch
+  pool_lease_wait
+  pool_lease_acquire
+  pool_lease_release
+  transaction_begin
+  transaction_commit
+  transaction_rollback)
+
+execute_process(
+  COMMAND ${READELF} -n --wide ${LIBRARY}
+  OUTPUT_VARIABLE SOCI_NOTES
+  RESULT_VARIABLE SOCI_READELF_RESULT)
+
+if (NOT SOCI_READELF_RESULT EQUAL 0)
+  message(FATAL_ERROR "Running ${READELF} on ${LIBRARY} failed.")
+endif()
+
+foreach(probe ${SOCI_EXPECTED_PROBES})
+  if (NOT SOCI_NOTES MATCHES "Provider: soci[\r\n]+[ \t]*Name: ${probe}[\r\n]")
+    message(FATAL_ERROR "USDT probe soci:${probe} not found in ${LIBRARY}.")
+  endif()
+
+  message(STATUS "Found USDT probe soci:${probe}")
+endforeach()